@@ -14,20 +14,92 @@
 #include "Led.h"
 #include "Dio.h"
 #include "Port.h"
+#include "Gpt.h"
+#include "Dio_Regs.h"
 
+#if (APP_PROFILING_API == STD_ON)
 
+#if (GPT_TIMESTAMP_API != STD_ON)
+  #error "The drivers profiling needs the Gpt timestamp (GPT_TIMESTAMP_API)"
+#endif
 
+App_ProfileType App_Profile;
+
+/* GPIODATA accesses of the LED1 pin compared by App_ProfileDrivers */
+#define APP_PROFILE_PIN_MASK      (uint8)(1 << DioConf_LED1_CHANNEL_NUM)
+#define APP_PROFILE_APERTURE_REG  (*(volatile uint32 *)(DIO_PORTF_BASE_ADDRESS + DIO_MASKED_DATA_REG_OFFSET(APP_PROFILE_PIN_MASK)))
+#define APP_PROFILE_FULL_REG      (*(volatile uint32 *)(DIO_PORTF_BASE_ADDRESS + DIO_DATA_REG_OFFSET))
+
+/* Description: Measure one call of every Dio write service in core clock cycles.
+ * Port_Init is measured by Init_Task itself as it runs once.
+ * Both GPIODATA accesses selectable by DIO_MASKED_DATA_ACCESS are measured in the same build on the LED1 pin:
+ * the single store through the pin aperture , and the read-modify-write of the full register (0x3FC).
+ * Every write stores the level already driven , so the outputs do not change.
+ * The cycles of two back to back timestamp reads are measured first and removed from every result.
+ */
+static void App_ProfileDrivers(void)
+{
+    uint32 Start;
+    uint32 Overhead;
+    Dio_LevelType Channel_Level = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    Dio_PortLevelType Port_Level = Dio_ReadPort(DioConf_PORTF_PORT_ID);
+    Dio_PortLevelType Group_Level = Dio_ReadChannelGroup(DioConf_RGB_LEDS_GROUP_PTR);
+    uint32 Pin_Level = APP_PROFILE_APERTURE_REG;
+
+    Start = Gpt_GetTimestampLow();
+    Overhead = Gpt_GetTimestampLow() - Start;
+
+    Start = Gpt_GetTimestampLow();
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, Channel_Level);
+    App_Profile.Dio_WriteChannel = (Gpt_GetTimestampLow() - Start) - Overhead;
+
+    Start = Gpt_GetTimestampLow();
+    Dio_WritePort(DioConf_PORTF_PORT_ID, Port_Level);
+    App_Profile.Dio_WritePort = (Gpt_GetTimestampLow() - Start) - Overhead;
+
+    Start = Gpt_GetTimestampLow();
+    Dio_WriteChannelGroup(DioConf_RGB_LEDS_GROUP_PTR, Group_Level);
+    App_Profile.Dio_WriteChannelGroup = (Gpt_GetTimestampLow() - Start) - Overhead;
+
+    Start = Gpt_GetTimestampLow();
+    APP_PROFILE_APERTURE_REG = Pin_Level;
+    App_Profile.Data_ApertureStore = (Gpt_GetTimestampLow() - Start) - Overhead;
+
+    Start = Gpt_GetTimestampLow();
+    APP_PROFILE_FULL_REG = (APP_PROFILE_FULL_REG & ~(uint32)APP_PROFILE_PIN_MASK) | Pin_Level;
+    App_Profile.Data_FullPortRmw = (Gpt_GetTimestampLow() - Start) - Overhead;
+}
+#endif
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
+    /* Initialize Gpt Driver first , its timestamp is available to measure the other drivers ,
+     * SysTick stays owned by the Os */
+    Gpt_Init(&Gpt_Configuration);
 
     /* Initialize Port Driver */
+#if (APP_PROFILING_API == STD_ON)
+    {
+        uint32 Start = Gpt_GetTimestampLow();
+
+        Port_Init(&Port_Configuration);
+        App_Profile.Port_Init = Gpt_GetTimestampLow() - Start;
+    }
+#else
     Port_Init(&Port_Configuration);
+#endif
 
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
+#if (APP_PROFILING_API == STD_ON)
+    App_ProfileDrivers();
+#endif
+
+    /* Initialize the Button , its pin interrupt starts the debouncing */
+    Button_init();
+
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
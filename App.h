@@ -14,6 +14,31 @@
 
 #include "Std_Types.h"
 
+/*
+ * Pre-compile option for the drivers profiling
+ * STD_ON  - Init_Task measures the core clock cycles of Port_Init and the Dio writes with Gpt_GetTimestampLow
+ *           and keeps them in App_Profile , to be read with the debugger.
+ * STD_OFF - No measurement.
+ */
+#define APP_PROFILING_API                   (STD_OFF)
+
+#if (APP_PROFILING_API == STD_ON)
+/* Core clock cycles of one call of every measured service , the overhead of the timestamp read is removed */
+typedef struct
+{
+    uint32 Port_Init;
+    uint32 Dio_WriteChannel;
+    uint32 Dio_WritePort;
+    uint32 Dio_WriteChannelGroup;
+    /* The two GPIODATA accesses selectable by DIO_MASKED_DATA_ACCESS , measured on the same pin */
+    uint32 Data_ApertureStore;
+    uint32 Data_FullPortRmw;
+} App_ProfileType;
+
+/* Cycles measured by Init_Task */
+extern App_ProfileType App_Profile;
+#endif
+
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
@@ -16,6 +16,27 @@
 /* Global variable to hold the button state */
 static uint8 g_button_state = BUTTON_RELEASED;
 
+/* Global variable set by the button pin interrupt , the button is debounced only after an edge */
+static volatile uint8 g_button_edge_flag = 0;
+
+/* Global variable to indicate that the button state is being debounced */
+static uint8 g_button_debouncing = 0;
+
+/* Description: Notification of the button pin interrupt , called by the GPIO port ISR */
+static void Button_EdgeNotification(void)
+{
+    g_button_edge_flag = 1;
+}
+
+void Button_init(void)
+{
+    Port_SetPinNotification(BUTTON_PORT_PIN_ID, Button_EdgeNotification);
+
+    /* Port_Init unmasks the pin interrupt before the notification is set , an edge in between is lost ,
+     * so debounce the current level once as the button may already be held */
+    g_button_debouncing = 1;
+}
+
 
 
 /*******************************************************************************************************************/
@@ -27,7 +48,17 @@ uint8 Button_GetState(void)
 /*******************************************************************************************************************/
 void Button_RefreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint8 state;
+
+    /* Nothing to do while the button is stable and no edge happened */
+    if((g_button_edge_flag == 0) && (g_button_debouncing == 0))
+    {
+        return;
+    }
+    g_button_edge_flag  = 0;
+    g_button_debouncing = 1;
+
+    state = Dio_ReadChannelSnapshot(DioConf_SW1_CHANNEL_ID_INDEX); /* sampled at the start of the tick */
 
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
@@ -51,12 +82,14 @@ void Button_RefreshState(void)
         g_button_state = BUTTON_PRESSED;
         g_Pressed_Count       = 0;
         g_Released_Count      = 0;
+        g_button_debouncing   = 0;
     }
     else if(g_Released_Count == 3)
     {
         g_button_state = BUTTON_RELEASED;
         g_Released_Count      = 0;
         g_Pressed_Count       = 0;
+        g_button_debouncing   = 0;
     }
 }
 /*******************************************************************************************************************/
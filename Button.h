@@ -15,11 +15,10 @@
 #include "Button_Cfg.h"
 
 /* 
- * Description: 1. Fill the button configurations structure 
- *              2. Set the PIN direction which the button is connected as INPUT pin
- *              3. Set the pin internal resistor
+ * Description: Set the notification of the button pin interrupt (both edges) configured by the Port Driver ,
+ *              the button is only sampled after an edge interrupt.
  */
-void Button_init();
+void Button_init(void);
 
 /* Description: Read the Button state Pressed/Released */
 uint8 Button_GetState(void);
@@ -28,6 +27,7 @@ uint8 Button_GetState(void);
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
  *		        and it should be in a RELEASED State if the button is released for 60ms.
+ *              It returns without sampling the button until an edge interrupt starts the debouncing.
  */   
 void Button_RefreshState(void);
 
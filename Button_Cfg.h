@@ -22,5 +22,8 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/* Set the Button Port Pin ID , configured with an interrupt on both edges by the Port Driver */
+#define BUTTON_PORT_PIN_ID PortConf_SW1_CHANNEL_ID_INDEX
+
 
 #endif /* BUTTON_CFG_H_ */
@@ -37,4 +37,12 @@
 /* Macro to get value of a specific bit */
 #define GET_BIT(REG,BIT) ( ( REG & (1<<BIT) ) >> BIT )
 
+/* Pin ID shared by the Port and Dio configurations : port number in bits [5:3] and pin number in bits [2:0] */
+#define PIN_ID(PORT,PIN)    ((((PORT) & 0x07U) << 3) | ((PIN) & 0x07U))
+#define PIN_ID_PORT(ID)     (((ID) >> 3) & 0x07U)
+#define PIN_ID_PIN(ID)      ((ID) & 0x07U)
+
+/* Break the build if the constant expression COND is false , NAME is the type name describing the rule */
+#define STATIC_ASSERT(COND,NAME) typedef char NAME[(COND) ? 1 : -1]
+
 #endif
@@ -51,4 +51,39 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to define the abstraction of the CLZ instruction (count leading zeros) ,
+   the result is undefined for X = 0 */
+#if defined(__TI_COMPILER_VERSION__)
+#define COUNT_LEADING_ZEROS(X)      ((uint8)_norm(X))
+#elif defined(__GNUC__)
+#define COUNT_LEADING_ZEROS(X)      ((uint8)__builtin_clz(X))
+#endif
+
+/* This is used to define the abstraction of the interrupts masking of a critical section :
+   SAVE_AND_DISABLE_INTERRUPTS returns PRIMASK then masks the interrupts , RESTORE_INTERRUPTS
+   puts the saved PRIMASK back , so a critical section entered with the interrupts already
+   masked leaves them masked */
+#if defined(__TI_COMPILER_VERSION__)
+#define SAVE_AND_DISABLE_INTERRUPTS()      ((uint32)_disable_IRQ())
+#define RESTORE_INTERRUPTS(STATE)          _restore_interrupts(STATE)
+#elif defined(__GNUC__)
+#define SAVE_AND_DISABLE_INTERRUPTS() \
+    __extension__ ({ uint32 Primask_State; __asm volatile (" MRS %0, PRIMASK\n CPSID I" : "=r" (Primask_State) :: "memory"); Primask_State; })
+#define RESTORE_INTERRUPTS(STATE) \
+    __asm volatile (" MSR PRIMASK, %0" :: "r" (STATE) : "memory")
+#endif
+
+/* This is used to define the abstraction of the exclusive byte access (LDREXB / STREXB) :
+   STORE_EXCLUSIVE_U8 returns 0 when the byte was not written by anyone since LOAD_EXCLUSIVE_U8 ,
+   otherwise nothing is stored and the read-modify-write shall be retried */
+#if defined(__TI_COMPILER_VERSION__)
+#define LOAD_EXCLUSIVE_U8(ADDRESS)             ((uint8)__ldrexb((void *)(ADDRESS)))
+#define STORE_EXCLUSIVE_U8(VALUE, ADDRESS)     ((uint32)__strexb((VALUE), (void *)(ADDRESS)))
+#elif defined(__GNUC__)
+#define LOAD_EXCLUSIVE_U8(ADDRESS) \
+    __extension__ ({ uint32 Exclusive_Value; __asm volatile (" LDREXB %0, [%1]" : "=r" (Exclusive_Value) : "r" (ADDRESS) : "memory"); (uint8)Exclusive_Value; })
+#define STORE_EXCLUSIVE_U8(VALUE, ADDRESS) \
+    __extension__ ({ uint32 Exclusive_Status; __asm volatile (" STREXB %0, %2, [%1]" : "=&r" (Exclusive_Status) : "r" (ADDRESS), "r" ((uint32)(VALUE)) : "memory"); Exclusive_Status; })
+#endif
+
 #endif
@@ -0,0 +1,80 @@
+ /******************************************************************************
+ *
+ * Module: Common - Post-build Configuration Image
+ *
+ * File Name: Config_Image.h
+ *
+ * Description: Header placed at the start of every post-build configuration image (Port sets and Dio
+ *              configuration) , so a configuration flashed without rebuilding the application is checked
+ *              against the module version and a CRC-32 before it is used.
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef CONFIG_IMAGE_H
+#define CONFIG_IMAGE_H
+
+#include "Std_Types.h"
+#include "Crc.h"
+
+/* First word of every image : "CFG1" read as a little-endian uint32 */
+#define CONFIG_IMAGE_MAGIC             (0x31474643U)
+
+/* Description: Header of a post-build configuration image , the payload directly follows it:
+ *
+ *  1. Magic word , Module Id and Vendor Id of the module owning the image.
+ *  2. AUTOSAR and SW versions of the module the image was built for
+ *     (the SW patch version is not checked , images stay valid across patch releases).
+ *  3. Index of the image slot (configuration set) the image was built for.
+ *  4. Length in bytes and CRC-32 (Crc_CalculateCRC32) of the payload.
+ *
+ * The layout is fixed (24 bytes , no padding) as it is also written by tools/config_image.py.
+ */
+typedef struct
+{
+    uint32  Magic;
+    uint16  Module_Id;
+    uint16  Vendor_Id;
+    uint8   Ar_Major_Version;
+    uint8   Ar_Minor_Version;
+    uint8   Ar_Patch_Version;
+    uint8   Sw_Major_Version;
+    uint8   Sw_Minor_Version;
+    uint8   Sw_Patch_Version;
+    uint8   Config_Id;
+    uint8   Reserved;
+    uint32  Length;
+    uint32  Crc;
+} Config_ImageHeaderType;
+
+/* Initializer of the header of an image built into the application */
+#define CONFIG_IMAGE_HEADER(MODULE,CONFIG_ID,LENGTH,CRC) \
+    { CONFIG_IMAGE_MAGIC , MODULE##_MODULE_ID , MODULE##_VENDOR_ID , \
+      MODULE##_AR_RELEASE_MAJOR_VERSION , MODULE##_AR_RELEASE_MINOR_VERSION , MODULE##_AR_RELEASE_PATCH_VERSION , \
+      MODULE##_SW_MAJOR_VERSION , MODULE##_SW_MINOR_VERSION , MODULE##_SW_PATCH_VERSION , \
+      (CONFIG_ID) , 0U , (LENGTH) , (CRC) }
+
+/* Description: Check an image against the header expected by its module (all the fields but the SW patch
+ *              version and the CRC) , then check the CRC-32 of its payload.
+ *              The header fields are compared first so a wrong image costs no CRC computation.
+ */
+LOCAL_INLINE boolean Config_ImageIsValid(const Config_ImageHeaderType * Image_Ptr , const Config_ImageHeaderType * Expected_Ptr)
+{
+    if((Image_Ptr->Magic            != CONFIG_IMAGE_MAGIC)
+    || (Image_Ptr->Module_Id        != Expected_Ptr->Module_Id)
+    || (Image_Ptr->Vendor_Id        != Expected_Ptr->Vendor_Id)
+    || (Image_Ptr->Ar_Major_Version != Expected_Ptr->Ar_Major_Version)
+    || (Image_Ptr->Ar_Minor_Version != Expected_Ptr->Ar_Minor_Version)
+    || (Image_Ptr->Ar_Patch_Version != Expected_Ptr->Ar_Patch_Version)
+    || (Image_Ptr->Sw_Major_Version != Expected_Ptr->Sw_Major_Version)
+    || (Image_Ptr->Sw_Minor_Version != Expected_Ptr->Sw_Minor_Version)
+    || (Image_Ptr->Config_Id        != Expected_Ptr->Config_Id)
+    || (Image_Ptr->Length           != Expected_Ptr->Length))
+    {
+        return FALSE;
+    }
+
+    return (boolean)(Crc_CalculateCRC32((const uint8 *)(Image_Ptr + 1) , Image_Ptr->Length , 0U , TRUE) == Image_Ptr->Crc);
+}
+
+#endif /* CONFIG_IMAGE_H */
@@ -0,0 +1,69 @@
+ /******************************************************************************
+ *
+ * Module: Crc
+ *
+ * File Name: Crc.h
+ *
+ * Description: Header file for the Crc library (CRC-32 used to check the post-build configuration images).
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef CRC_H
+#define CRC_H
+
+/* Id for the company in the AUTOSAR */
+#define CRC_VENDOR_ID    (1000U)
+
+/* Crc Module Id */
+#define CRC_MODULE_ID    (201U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define CRC_SW_MAJOR_VERSION           (1U)
+#define CRC_SW_MINOR_VERSION           (0U)
+#define CRC_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define CRC_AR_RELEASE_MAJOR_VERSION   (4U)
+#define CRC_AR_RELEASE_MINOR_VERSION   (0U)
+#define CRC_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Crc Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != CRC_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != CRC_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != CRC_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Start value and final XOR value of the CRC-32 (IEEE 802.3 , reflected polynomial 0xEDB88320) */
+#define CRC_INITIAL_VALUE32            (0xFFFFFFFFU)
+#define CRC_XOR_VALUE32                (0xFFFFFFFFU)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Crc_CalculateCRC32
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Crc_DataPtr - Pointer to the start of the data block.
+*                  Crc_Length - Length of the data block in bytes.
+*                  Crc_StartValue32 - Start value , the result of the previous call when Crc_IsFirstCall is FALSE.
+*                  Crc_IsFirstCall - TRUE for the first (or only) call of a sequence , the start value is then ignored.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - CRC-32 of the data block , same result as zlib crc32() on the host.
+* Description: Computes the CRC-32 of a data block one byte per step with a 256 entries table.
+************************************************************************************/
+uint32 Crc_CalculateCRC32(const uint8 * Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall);
+
+#endif /* CRC_H */
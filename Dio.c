@@ -24,56 +24,641 @@
 
 #endif
 
+/* GPIODATA register of a port seen through the aperture of the pins set in MASK (0xFF for the whole port) */
+#define DIO_PORT_DATA_REG(PortId, MASK) \
+	(*(volatile uint32 *)(Dio_PortBaseAddress[(PortId)] + DIO_MASKED_DATA_REG_OFFSET(MASK)))
+
+
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* GPIO Ports base addresses indexed by the Port Id stored in the Port_Num member */
+STATIC const uint32 Dio_PortBaseAddress[DIO_PORTS_NUM] =
+{
+	DIO_PORTA_BASE_ADDRESS, DIO_PORTB_BASE_ADDRESS, DIO_PORTC_BASE_ADDRESS,
+	DIO_PORTD_BASE_ADDRESS, DIO_PORTE_BASE_ADDRESS, DIO_PORTF_BASE_ADDRESS
+};
+
+/* Register address and bit mask of every configured channel, filled by Dio_Init */
+Dio_ChannelDescType Dio_ChannelDesc[DIO_CONFIGURED_CHANNLES];
+
+/* Last level written to every port, loaded from the ports by Dio_Init */
+Dio_PortLevelType Dio_OutputShadow[DIO_PORTS_NUM];
+
+/* Ports having configured channels, only these ports are clocked, sampled by Dio_TakeSnapshot
+ * and verified by Dio_VerifyOutputs */
+STATIC Dio_PortType Dio_ConfiguredPorts[DIO_PORTS_NUM];
+STATIC uint8 Dio_ConfiguredPortsNum = 0;
+
+/* Bit n is set when port n has configured channels, used to reject the ports without channels */
+STATIC uint8 Dio_ConfiguredPortsMask = 0;
+
+/* Description: Update the pins (Clear | Toggle) of a port shadow to (Shadow & ~Clear) ^ Toggle and store them.
+ *  With the masked access the shadow is updated with an exclusive access and the aperture store changes only
+ *  these pins , so nothing is masked. Without it the whole port shadow is stored through the full GPIODATA
+ *  register , so the update and the store are done in the critical section.
+ */
+LOCAL_INLINE void Dio_PortUpdate(Dio_PortType PortId, Dio_PortLevelType Clear, Dio_PortLevelType Toggle)
+{
+#if (DIO_MASKED_DATA_ACCESS == STD_ON)
+	DIO_PORT_DATA_REG(PortId, (Clear | Toggle)) = Dio_ShadowUpdate(PortId, Clear, Toggle);
+#else
+	uint32 Interrupts_State;
+
+	DIO_ENTER_CRITICAL_SECTION(Interrupts_State);
+	Dio_OutputShadow[PortId] = (Dio_PortLevelType)((Dio_OutputShadow[PortId] & ~Clear) ^ Toggle);
+	DIO_PORT_DATA_REG(PortId, 0xFF) = Dio_OutputShadow[PortId];
+	DIO_EXIT_CRITICAL_SECTION(Interrupts_State);
+#endif
+}
+
+#if (DIO_SNAPSHOT_API == STD_ON)
+/* Last snapshot of the configured ports */
+STATIC Dio_SnapshotType Dio_Snapshot;
+#endif
+
+/************************************************************************************
+* Service Name: Dio_Init
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Dio module.
+*              The configuration image is checked first (header and CRC) ,
+*              the module stays not initialized if it fails.
+************************************************************************************/
+void Dio_Init(const Dio_ConfigType * ConfigPtr)
+{
+	/* Header expected in the configuration image , its CRC is checked against the payload */
+	const Config_ImageHeaderType Expected = CONFIG_IMAGE_HEADER(DIO , 0U , DIO_CONFIG_IMAGE_LENGTH , 0U);
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+		     DIO_E_PARAM_CONFIG);
+	}
+	else
+#endif
+	/* a configuration image failing the header or the CRC checks is never used */
+	if (FALSE == Config_ImageIsValid(&ConfigPtr->Header, &Expected))
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+		     DIO_E_PARAM_CONFIG);
+#endif
+	}
+	else
+	{
+		Dio_ChannelType ChannelId;
+
+		/*
+		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
+		 * This global pointer is global to be used by other functions to read the PB configuration structures
+		 */
+		Dio_Status       = DIO_INITIALIZED;
+		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		/* Resolve the DATA register address and the bit mask of each channel once,
+		 * so the channel APIs do a single indexed load instead of a port lookup */
+		for(ChannelId = 0; ChannelId < DIO_CONFIGURED_CHANNLES; ChannelId++)
+		{
+			Dio_ChannelDesc[ChannelId].Mask     = (uint8)(1U << PIN_ID_PIN(Dio_PortChannels[ChannelId]));
+			Dio_ChannelDesc[ChannelId].Port_Num = (Dio_PortType)PIN_ID_PORT(Dio_PortChannels[ChannelId]);
+#if ((DIO_BIT_BAND_ACCESS == STD_ON) || (DIO_MASKED_DATA_ACCESS == STD_ON))
+			Dio_ChannelDesc[ChannelId].Shadow_Ptr = (volatile uint32 *)DIO_SRAM_BIT_BAND_ALIAS_ADDRESS(
+			                                        &Dio_OutputShadow[Dio_ChannelDesc[ChannelId].Port_Num],
+			                                        PIN_ID_PIN(Dio_PortChannels[ChannelId]));
+#endif
+#if (DIO_BIT_BAND_ACCESS == STD_ON)
+			/* Alias word of the channel bit inside the channel's own GPIODATA aperture, so even the
+			 * bit-band read-modify-write done by the bus matrix never touches the other pins */
+			Dio_ChannelDesc[ChannelId].Data_Ptr = (volatile uint32 *)DIO_BIT_BAND_ALIAS_ADDRESS(
+			                                      Dio_PortBaseAddress[Dio_ChannelDesc[ChannelId].Port_Num]
+			                                      + DIO_MASKED_DATA_REG_OFFSET(Dio_ChannelDesc[ChannelId].Mask),
+			                                      PIN_ID_PIN(Dio_PortChannels[ChannelId]));
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+			Dio_ChannelDesc[ChannelId].Data_Ptr = (volatile uint32 *)(Dio_PortBaseAddress[Dio_ChannelDesc[ChannelId].Port_Num]
+			                                      + DIO_MASKED_DATA_REG_OFFSET(Dio_ChannelDesc[ChannelId].Mask));
+#else
+			Dio_ChannelDesc[ChannelId].Data_Ptr = (volatile uint32 *)(Dio_PortBaseAddress[Dio_ChannelDesc[ChannelId].Port_Num]
+			                                      + DIO_DATA_REG_OFFSET);
+#endif
+		}
+
+		/* Build the list of the configured ports and load their output shadow,
+		 * this is the only read of the port levels done by the Dio write APIs */
+		{
+			uint8 Used_Ports = 0;
+			Dio_PortType PortId;
+
+			for(ChannelId = 0; ChannelId < DIO_CONFIGURED_CHANNLES; ChannelId++)
+			{
+				Used_Ports |= (uint8)(1U << Dio_ChannelDesc[ChannelId].Port_Num);
+			}
+			Dio_ConfiguredPortsNum = 0;
+			Dio_ConfiguredPortsMask = Used_Ports;
+			for(PortId = 0; PortId < DIO_PORTS_NUM; PortId++)
+			{
+				if(BIT_IS_SET(Used_Ports, PortId))
+				{
+					Dio_ConfiguredPorts[Dio_ConfiguredPortsNum] = PortId;
+					Dio_ConfiguredPortsNum++;
+					Dio_OutputShadow[PortId] = (Dio_PortLevelType)DIO_PORT_DATA_REG(PortId, 0xFF);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+		}
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannel
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a level of a channel.
+************************************************************************************/
+void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Access the channel through the descriptor resolved by Dio_Init */
+		Dio_WriteChannelInline(ChannelId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannel
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to return the value of the specified DIO channel.
+************************************************************************************/
+Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Access the channel through the descriptor resolved by Dio_Init */
+		output = Dio_ReadChannelInline(ChannelId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadOutputChannel
+* Service ID[hex]: 0x19
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to return the last level written to the specified DIO channel,
+*              read from the output shadow without accessing the port.
+************************************************************************************/
+Dio_LevelType Dio_ReadOutputChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_OUTPUT_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_OUTPUT_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = Dio_ReadOutputChannelInline(ChannelId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range and has configured channels */
+	if ((DIO_PORTS_NUM <= PortId) || BIT_IS_CLEAR(Dio_ConfiguredPortsMask, PortId))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read all the port pins with a single load */
+		output = (Dio_PortLevelType)DIO_PORT_DATA_REG(PortId, 0xFF);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a value of the port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range and has configured channels */
+	if ((DIO_PORTS_NUM <= PortId) || BIT_IS_CLEAR(Dio_ConfiguredPortsMask, PortId))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Write all the port pins with a single store, the input pins ignore the written value */
+		Dio_PortUpdate(PortId, 0xFF, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_MaskedWritePort
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+*                  Mask - Channels to be masked in the port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the value of the port channels selected by the mask,
+*              the other channels of the port are not changed.
+************************************************************************************/
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range and has configured channels */
+	if ((DIO_PORTS_NUM <= PortId) || BIT_IS_CLEAR(Dio_ConfiguredPortsMask, PortId))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Update the masked pins in the shadow then store them with a single store */
+		Dio_PortUpdate(PortId, Mask, (Dio_PortLevelType)(Level & Mask));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port,
+*              the result is shifted down by the group offset.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the group belongs to a valid port having configured channels */
+	else if ((DIO_PORTS_NUM <= ChannelGroupIdPtr->PortIndex)
+	         || BIT_IS_CLEAR(Dio_ConfiguredPortsMask, ChannelGroupIdPtr->PortIndex))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Single load through the aperture of the group pins, then align the group to the LSB */
+		output = (Dio_PortLevelType)(DIO_PORT_DATA_REG(ChannelGroupIdPtr->PortIndex, ChannelGroupIdPtr->mask)
+		                             >> ChannelGroupIdPtr->offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
 /************************************************************************************
-* Service Name: Dio_Init
-* Service ID[hex]: 0x10
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
 * Sync/Async: Synchronous
-* Reentrancy: Non reentrant
-* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Initialize the Dio module.
+* Description: Function to set a subset of the adjoining bits of a port,
+*              the level is shifted up by the group offset.
 ************************************************************************************/
-void Dio_Init(const Dio_ConfigType * ConfigPtr)
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level)
 {
+	boolean error = FALSE;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
-	/* check if the input configuration pointer is not a NULL_PTR */
-	if (NULL_PTR == ConfigPtr)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
-		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
-		     DIO_E_PARAM_CONFIG);
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the group belongs to a valid port having configured channels */
+	else if ((DIO_PORTS_NUM <= ChannelGroupIdPtr->PortIndex)
+	         || BIT_IS_CLEAR(Dio_ConfiguredPortsMask, ChannelGroupIdPtr->PortIndex))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
 	}
 	else
+	{
+		/* No Action Required */
+	}
 #endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
 	{
-		/*
-		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
-		 * This global pointer is global to be used by other functions to read the PB configuration structures
-		 */
-		Dio_Status       = DIO_INITIALIZED;
-		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		/* Update the group pins in the shadow then store them with a single store */
+		Dio_PortUpdate(ChannelGroupIdPtr->PortIndex, ChannelGroupIdPtr->mask,
+		               (Dio_PortLevelType)(((uint32)Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask));
+	}
+	else
+	{
+		/* No Action Required */
 	}
 }
 
 /************************************************************************************
-* Service Name: Dio_WriteChannel
-* Service ID[hex]: 0x01
+* Service Name: Dio_WriteChannels
+* Service ID[hex]: 0x14
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): ChannelId - ID of DIO channel.
-*                  Level - Value to be written.
+* Parameters (in): ChannelLevelsPtr - Pointer to the list of channels and their levels.
+*                  Count - Number of the elements in the list.
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to set a level of a channel.
+* Description: Function to set the levels of several channels. The channels are grouped by
+*              their port and every touched port is written with a single register operation,
+*              so all the outputs of the same port change on the same clock edge.
 ************************************************************************************/
-void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+#if (DIO_MULTI_CHANNEL_API == STD_ON)
+void Dio_WriteChannels(const Dio_ChannelLevelType *ChannelLevelsPtr, uint8 Count)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	uint8 Port_Touched[DIO_PORTS_NUM] = {0};
+	uint8 Port_Level[DIO_PORTS_NUM]   = {0};
+	Dio_PortType PortId;
+	uint8 Index;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -81,78 +666,218 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_WRITE_CHANNEL_SID, DIO_E_UNINIT);
+				DIO_WRITE_CHANNELS_SID, DIO_E_UNINIT);
 		error = TRUE;
 	}
 	else
 	{
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelLevelsPtr)
 	{
-
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_POINTER);
 		error = TRUE;
 	}
 	else
 	{
-		/* No Action Required */
+		/* Check if all the used channels are within the valid range */
+		for(Index = 0; Index < Count; Index++)
+		{
+			if (DIO_CONFIGURED_CHANNLES <= ChannelLevelsPtr[Index].ChannelId)
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+						DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
 	}
 #endif
 
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
+		/* Fold the requested levels into one pins mask and one level mask per port */
+		for(Index = 0; Index < Count; Index++)
+		{
+			PortId = Dio_ChannelDesc[ChannelLevelsPtr[Index].ChannelId].Port_Num;
+			if(ChannelLevelsPtr[Index].Level == STD_HIGH)
+			{
+				Port_Touched[PortId] |= Dio_ChannelDesc[ChannelLevelsPtr[Index].ChannelId].Mask;
+				Port_Level[PortId]   |= Dio_ChannelDesc[ChannelLevelsPtr[Index].ChannelId].Mask;
+			}
+			else if(ChannelLevelsPtr[Index].Level == STD_LOW)
+			{
+				Port_Touched[PortId] |= Dio_ChannelDesc[ChannelLevelsPtr[Index].ChannelId].Mask;
+				Port_Level[PortId]   &= (uint8)~Dio_ChannelDesc[ChannelLevelsPtr[Index].ChannelId].Mask;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+
+		/* Issue one store per touched port */
+		for(PortId = 0; PortId < DIO_PORTS_NUM; PortId++)
+		{
+			if(Port_Touched[PortId] != 0)
+			{
+				Dio_PortUpdate(PortId, Port_Touched[PortId], Port_Level[PortId]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_FlipChannels
+* Service ID[hex]: 0x15
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelIdsPtr - Pointer to the list of channels to be flipped.
+*                  Count - Number of the elements in the list.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to flip the levels of several channels. The channels are grouped by
+*              their port and every touched port is flipped with a single register operation.
+************************************************************************************/
+void Dio_FlipChannels(const Dio_ChannelType *ChannelIdsPtr, uint8 Count)
+{
+	uint8 Port_Toggle[DIO_PORTS_NUM] = {0};
+	Dio_PortType PortId;
+	uint8 Index;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNELS_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == ChannelIdsPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNELS_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* Check if all the used channels are within the valid range */
+		for(Index = 0; Index < Count; Index++)
 		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
+			if (DIO_CONFIGURED_CHANNLES <= ChannelIdsPtr[Index])
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+						DIO_FLIP_CHANNELS_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
 		}
-		if(Level == STD_HIGH)
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Fold the channels into one toggle mask per port */
+		for(Index = 0; Index < Count; Index++)
 		{
-			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			Port_Toggle[Dio_ChannelDesc[ChannelIdsPtr[Index]].Port_Num] |= Dio_ChannelDesc[ChannelIdsPtr[Index]].Mask;
 		}
-		else if(Level == STD_LOW)
+
+		/* Invert the channels in the shadow and issue one store per touched port */
+		for(PortId = 0; PortId < DIO_PORTS_NUM; PortId++)
 		{
-			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			if(Port_Toggle[PortId] != 0)
+			{
+				Dio_PortUpdate(PortId, 0U, Port_Toggle[PortId]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
 		}
 	}
 	else
 	{
 		/* No Action Required */
 	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_TakeSnapshot
+* Service ID[hex]: 0x16
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Tick - Tick count to be stamped on the snapshot.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to read the DATA register of every configured port back-to-back
+*              into the snapshot, so all the channel reads of the same tick are served
+*              from one coherent sample with one bus read per port.
+************************************************************************************/
+#if (DIO_SNAPSHOT_API == STD_ON)
+void Dio_TakeSnapshot(uint32 Tick)
+{
+	uint8 Index;
 
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_TAKE_SNAPSHOT_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(Index = 0; Index < Dio_ConfiguredPortsNum; Index++)
+		{
+			Dio_Snapshot.Port_Levels[Dio_ConfiguredPorts[Index]] =
+					(Dio_PortLevelType)DIO_PORT_DATA_REG(Dio_ConfiguredPorts[Index], 0xFF);
+		}
+		Dio_Snapshot.Tick = Tick;
+	}
 }
 
 /************************************************************************************
-* Service Name: Dio_ReadChannel
-* Service ID[hex]: 0x00
+* Service Name: Dio_ReadChannelSnapshot
+* Service ID[hex]: 0x17
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
 * Parameters (in): ChannelId - ID of DIO channel.
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: Dio_LevelType
-* Description: Function to return the value of the specified DIO channel.
+* Description: Function to return the value of the specified DIO channel from the last snapshot.
 ************************************************************************************/
-Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
+Dio_LevelType Dio_ReadChannelSnapshot(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -161,7 +886,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_READ_CHANNEL_SID, DIO_E_UNINIT);
+				DIO_READ_CHANNEL_SNAPSHOT_SID, DIO_E_UNINIT);
 		error = TRUE;
 	}
 	else
@@ -173,7 +898,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	{
 
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				DIO_READ_CHANNEL_SNAPSHOT_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
 		error = TRUE;
 	}
 	else
@@ -185,24 +910,8 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+		/* Read the required channel from the sampled port level */
+		if(Dio_Snapshot.Port_Levels[Dio_ChannelDesc[ChannelId].Port_Num] & Dio_ChannelDesc[ChannelId].Mask)
 		{
 			output = STD_HIGH;
 		}
@@ -218,6 +927,140 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
         return output;
 }
 
+/************************************************************************************
+* Service Name: Dio_GetSnapshot
+* Service ID[hex]: 0x18
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): SnapshotPtr - Pointer to where to copy the last snapshot.
+* Return value: None
+* Description: Function to get a copy of the last snapshot of the configured ports.
+************************************************************************************/
+void Dio_GetSnapshot(Dio_SnapshotType *SnapshotPtr)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == SnapshotPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_SNAPSHOT_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		*SnapshotPtr = Dio_Snapshot;
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_VerifyOutputs
+* Service ID[hex]: 0x1A
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the output pins of all the configured ports match
+*                                the output shadow, E_NOT_OK otherwise.
+* Description: Function to detect corrupted outputs, only the pins configured as outputs
+*              in GPIODIR are compared.
+************************************************************************************/
+#if (DIO_OUTPUTS_VERIFY_API == STD_ON)
+Std_ReturnType Dio_VerifyOutputs(void)
+{
+	Std_ReturnType output = E_OK;
+	uint8 Index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_VERIFY_OUTPUTS_SID, DIO_E_UNINIT);
+		output = E_NOT_OK;
+	}
+	else
+#endif
+	{
+		for(Index = 0; Index < Dio_ConfiguredPortsNum; Index++)
+		{
+			Dio_PortType PortId = Dio_ConfiguredPorts[Index];
+			uint32 Output_Pins  = *(volatile uint32 *)(Dio_PortBaseAddress[PortId] + DIO_DIR_REG_OFFSET);
+
+			if(((DIO_PORT_DATA_REG(PortId, 0xFF) ^ Dio_OutputShadow[PortId]) & Output_Pins & 0xFF) != 0)
+			{
+				output = E_NOT_OK;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ResyncOutputs
+* Service ID[hex]: 0x1B
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to rewrite the output shadow to all the configured ports,
+*              one store per port, the input pins ignore the written value.
+************************************************************************************/
+void Dio_ResyncOutputs(void)
+{
+	uint8 Index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_RESYNC_OUTPUTS_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(Index = 0; Index < Dio_ConfiguredPortsNum; Index++)
+		{
+			uint32 Interrupts_State;
+
+			DIO_ENTER_CRITICAL_SECTION(Interrupts_State);
+			DIO_PORT_DATA_REG(Dio_ConfiguredPorts[Index], 0xFF) = Dio_OutputShadow[Dio_ConfiguredPorts[Index]];
+			DIO_EXIT_CRITICAL_SECTION(Interrupts_State);
+		}
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_PortLevelsCallout
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of the port whose initial levels were stored by Port.
+*                  Mask - Pins whose level was stored.
+*                  Level - Levels stored to the pins of Mask.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Callout configured in Port_Cfg.h and called by Port_SwitchConfiguration inside its critical
+*              section , the stored levels replace the shadow of these pins so the outputs are verified and
+*              resynchronized against them. The calls of Port_Init come before Dio_Init , which loads the
+*              whole shadow from the ports. No parameter is checked , Port only reports its own ports.
+************************************************************************************/
+void Dio_PortLevelsCallout(Dio_PortType PortId, Dio_PortLevelType Mask, Dio_PortLevelType Level)
+{
+	(void)Dio_ShadowUpdate(PortId, Mask, (Dio_PortLevelType)(Level & Mask));
+}
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -271,7 +1114,6 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -304,33 +1146,8 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel and write the required level */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
-		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_LOW;
-		}
-		else
-		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_HIGH;
-		}
+		/* Access the channel through the descriptor resolved by Dio_Init */
+		output = Dio_FlipChannelInline(ChannelId);
 	}
 	else
 	{
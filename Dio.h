@@ -71,6 +71,7 @@
 
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
+#include "Config_Image.h"
 
 /******************************************************************************
  *                      API Service Id Macros                                 *
@@ -102,6 +103,33 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO masked write Port */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
+/* Service ID for DIO write multiple Channels (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_CHANNELS_SID         (uint8)0x14
+
+/* Service ID for DIO flip multiple Channels (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_FLIP_CHANNELS_SID          (uint8)0x15
+
+/* Service ID for DIO take Snapshot (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_TAKE_SNAPSHOT_SID          (uint8)0x16
+
+/* Service ID for DIO read Channel from Snapshot (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_CHANNEL_SNAPSHOT_SID  (uint8)0x17
+
+/* Service ID for DIO get Snapshot (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_GET_SNAPSHOT_SID           (uint8)0x18
+
+/* Service ID for DIO read output Channel */
+#define DIO_READ_OUTPUT_CHANNEL_SID    (uint8)0x19
+
+/* Service ID for DIO verify outputs */
+#define DIO_VERIFY_OUTPUTS_SID         (uint8)0x1A
+
+/* Service ID for DIO resync outputs */
+#define DIO_RESYNC_OUTPUTS_SID         (uint8)0x1B
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -128,6 +156,13 @@
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
  */
 #define DIO_E_UNINIT                   (uint8)0xF0
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Number of the GPIO ports PORT_A .. PORT_F */
+#define DIO_PORTS_NUM                  (6U)
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -155,40 +190,122 @@ typedef struct
   Dio_PortType PortIndex;
 } Dio_ChannelGroupType;
 
+/* Type definition for the configuration of a channel: the PIN_ID of the channel (port number in bits [5:3]
+ * and channel number in bits [2:0]) , the same layout as bits [5:0] of the Port_ConfigChannel word */
+typedef uint8 Dio_ConfigChannel;
+
+/* Structure holding a channel and the level to be written to it by Dio_WriteChannels */
+typedef struct
+{
+	Dio_ChannelType ChannelId;
+	Dio_LevelType Level;
+} Dio_ChannelLevelType;
+
+/* Structure holding a coherent sample of the configured ports taken by Dio_TakeSnapshot */
+typedef struct
+{
+	/* Level of each port indexed by the Port Id, ports without configured channels read as 0 */
+	Dio_PortLevelType Port_Levels[DIO_PORTS_NUM];
+	/* Tick count passed to Dio_TakeSnapshot when the sample was taken */
+	uint32 Tick;
+} Dio_SnapshotType;
+
+/* Structure holding the register access of a configured channel, resolved once by Dio_Init */
 typedef struct
 {
-	/* Member contains the ID of the Port that this channel belongs to */
+	/* Address used to access the channel , according to Dio_Cfg.h:
+	 * - DIO_BIT_BAND_ACCESS : the bit-band alias word of the pin , reads and stores 0 or 1.
+	 * - DIO_MASKED_DATA_ACCESS : the GPIODATA aperture of the pin , a store changes only this pin.
+	 * - otherwise : the full GPIODATA register (0x3FC) , a store writes the whole port. */
+	volatile uint32 * Data_Ptr;
+#if ((DIO_BIT_BAND_ACCESS == STD_ON) || (DIO_MASKED_DATA_ACCESS == STD_ON))
+	/* SRAM bit-band alias word of the channel bit in Dio_OutputShadow , a store of 0 or 1
+	 * updates the shadow bit atomically without masking the interrupts */
+	volatile uint32 * Shadow_Ptr;
+#endif
+	/* Bit mask of the channel inside its port */
+	uint8 Mask;
+	/* ID of the Port that this channel belongs to, indexes the output shadow */
 	Dio_PortType Port_Num;
-	/* Member contains the ID of the Channel*/
-	Dio_ChannelType Ch_Num;
-}Dio_ConfigChannel;
+} Dio_ChannelDescType;
 
-/* Data Structure required for initializing the Dio Driver */
+/* Data Structure required for initializing the Dio Driver , a post-build configuration image:
+ * the image header followed by the channels and the channel groups , covered by the CRC of the header */
 typedef struct Dio_ConfigType
 {
+	Config_ImageHeaderType Header;
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_CHANNEL_GROUPS];
 } Dio_ConfigType;
 
+/* Length of the payload of the configuration image , the tail padding of Dio_ConfigType is not covered */
+#define DIO_CONFIG_IMAGE_LENGTH        ((DIO_CONFIGURED_CHANNLES * 1U) + (DIO_CONFIGURED_CHANNEL_GROUPS * 3U))
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* Function for DIO masked write Port API */
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask);
+#endif
+
 /* Function for DIO read Port API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
 /* Function for DIO write Port API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+#if (DIO_MULTI_CHANNEL_API == STD_ON)
+/* Function for DIO write multiple Channels API, one register operation per touched port */
+void Dio_WriteChannels(const Dio_ChannelLevelType *ChannelLevelsPtr, uint8 Count);
+
+/* Function for DIO flip multiple Channels API, one register operation per touched port */
+void Dio_FlipChannels(const Dio_ChannelType *ChannelIdsPtr, uint8 Count);
+#endif
+
+#if (DIO_SNAPSHOT_API == STD_ON)
+/* Function for DIO take Snapshot API, reads every configured port back-to-back */
+void Dio_TakeSnapshot(uint32 Tick);
+
+/* Function for DIO read Channel from the last Snapshot API */
+Dio_LevelType Dio_ReadChannelSnapshot(Dio_ChannelType ChannelId);
+
+/* Function for DIO get Snapshot API */
+void Dio_GetSnapshot(Dio_SnapshotType *SnapshotPtr);
+#endif
+
+/* Function for DIO read output Channel API, returns the last written level from the output shadow */
+Dio_LevelType Dio_ReadOutputChannel(Dio_ChannelType ChannelId);
+
+#if (DIO_OUTPUTS_VERIFY_API == STD_ON)
+/* Function for DIO verify outputs API, compares the output pins against the output shadow */
+Std_ReturnType Dio_VerifyOutputs(void);
+
+/* Function for DIO resync outputs API, rewrites the output shadow to the configured ports */
+void Dio_ResyncOutputs(void);
+#endif
+
 /* Function for DIO Initialization API */
 void Dio_Init(const Dio_ConfigType * ConfigPtr);
 
+/* Callout of Port_SwitchConfiguration (PORT_SWITCH_LEVELS_CALLOUT in Port_Cfg.h) , records in the output
+ * shadow the initial levels Port stored to the pins of Mask , so Dio_VerifyOutputs and Dio_ResyncOutputs keep them */
+void Dio_PortLevelsCallout(Dio_PortType PortId, Dio_PortLevelType Mask, Dio_PortLevelType Level);
+
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 /* Function for DIO flip channel API */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
@@ -206,4 +323,176 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /* Extern PB structures to be used by Dio and other modules */
 extern const Dio_ConfigType Dio_Configuration;
 
+/* Channel descriptors resolved by Dio_Init, used by the inline channel APIs below */
+extern Dio_ChannelDescType Dio_ChannelDesc[DIO_CONFIGURED_CHANNLES];
+
+/* RAM copy of the last level written to every port , all the Dio writes go shadow first then
+ * to the hardware as a single store , so the output level is never read back from the port */
+extern Dio_PortLevelType Dio_OutputShadow[DIO_PORTS_NUM];
+
+/* Symbolic names of the configured channel groups to be used with the Dio channel group APIs */
+#define DioConf_RGB_LEDS_GROUP_PTR     (&Dio_Configuration.Groups[DioConf_RGB_LEDS_GROUP_ID_INDEX])
+
+/*******************************************************************************
+ *                      Inline Channel Access                                  *
+ *******************************************************************************/
+
+#if (DIO_BIT_BAND_ACCESS == STD_ON)
+/* The channel descriptor points to the bit-band alias word of its own pin,
+ * the word reads as 0 or 1 and a store of 0 or 1 changes only this pin */
+#define DIO_CHANNEL_READ(Channel_Ptr)         (*(Channel_Ptr)->Data_Ptr)
+#else
+/* The channel descriptor points to a GPIODATA address , the channel bit is selected by its mask */
+#define DIO_CHANNEL_READ(Channel_Ptr)         (*(Channel_Ptr)->Data_Ptr & (Channel_Ptr)->Mask)
+#endif
+
+/*
+ * Critical section only used around a store of the whole port shadow through the full GPIODATA
+ * register (0x3FC) , where a stale shadow would overwrite the pins written by a preempting task or ISR.
+ * The aperture and bit-band stores change only their own pins and are never masked.
+ * PRIMASK is saved and restored , the APIs can be called with the interrupts already masked.
+ */
+#define DIO_ENTER_CRITICAL_SECTION(STATE)     ((STATE) = SAVE_AND_DISABLE_INTERRUPTS())
+#define DIO_EXIT_CRITICAL_SECTION(STATE)      RESTORE_INTERRUPTS(STATE)
+
+/*
+ * Atomic update of the shadow of a port : Shadow = (Shadow & ~Clear) ^ Toggle with an LDREXB / STREXB
+ * loop retried when a preempting write changed the shadow in between , returns the new shadow.
+ */
+LOCAL_INLINE Dio_PortLevelType Dio_ShadowUpdate(Dio_PortType PortId, Dio_PortLevelType Clear, Dio_PortLevelType Toggle)
+{
+	Dio_PortLevelType Level;
+
+	do
+	{
+		Level = (Dio_PortLevelType)((LOAD_EXCLUSIVE_U8(&Dio_OutputShadow[PortId]) & ~Clear) ^ Toggle);
+	} while(0U != STORE_EXCLUSIVE_U8(Level, &Dio_OutputShadow[PortId]));
+
+	return Level;
+}
+
+/*
+ * Evaluates to 0 and breaks the build if ChannelId is not a compile-time constant
+ * or is out of the configured channels range (bit-field width must be a positive constant).
+ */
+#define DIO_CONST_CHANNEL_CHECK(ChannelId) \
+	(0U * sizeof(struct { unsigned int Dio_InvalidChannelId : (((ChannelId) < DIO_CONFIGURED_CHANNLES) ? 1 : -1); }))
+
+/*
+ * Channel APIs for compile-time constant channel IDs:
+ * The ID is range checked at compile time and the access is expanded in place (no call,
+ * no Dio_Status check and no DET checks), so they shall only be used after Dio_Init.
+ * Non-constant IDs shall use Dio_ReadChannel / Dio_WriteChannel / Dio_FlipChannel.
+ */
+#define Dio_WriteChannelConst(ChannelId, Level) \
+	Dio_WriteChannelInline((Dio_ChannelType)((ChannelId) + DIO_CONST_CHANNEL_CHECK(ChannelId)), (Level))
+
+#define Dio_ReadChannelConst(ChannelId) \
+	Dio_ReadChannelInline((Dio_ChannelType)((ChannelId) + DIO_CONST_CHANNEL_CHECK(ChannelId)))
+
+#define Dio_ReadOutputChannelConst(ChannelId) \
+	Dio_ReadOutputChannelInline((Dio_ChannelType)((ChannelId) + DIO_CONST_CHANNEL_CHECK(ChannelId)))
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+#define Dio_FlipChannelConst(ChannelId) \
+	Dio_FlipChannelInline((Dio_ChannelType)((ChannelId) + DIO_CONST_CHANNEL_CHECK(ChannelId)))
+#endif
+
+/* Inline body of Dio_WriteChannel without the parameters checking */
+LOCAL_INLINE void Dio_WriteChannelInline(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	const Dio_ChannelDescType * Channel_Ptr = &Dio_ChannelDesc[ChannelId];
+
+#if (DIO_BIT_BAND_ACCESS == STD_ON)
+	/* The alias words hold only the channel bit , only bit 0 of the level is used so any other value
+	   drives the same level into the shadow and the pin without branching */
+	*Channel_Ptr->Shadow_Ptr = (Level & 1U);
+	*Channel_Ptr->Data_Ptr   = (Level & 1U);
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+	/* The shadow bit is set through its bit-band alias and the aperture store changes only this pin */
+	if(Level == STD_HIGH)
+	{
+		/* Write Logic High */
+		*Channel_Ptr->Shadow_Ptr = 1U;
+		*Channel_Ptr->Data_Ptr   = Channel_Ptr->Mask;
+	}
+	else if(Level == STD_LOW)
+	{
+		/* Write Logic Low */
+		*Channel_Ptr->Shadow_Ptr = 0U;
+		*Channel_Ptr->Data_Ptr   = 0U;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#else
+	uint32 Interrupts_State;
+
+	/* The whole port shadow is stored , so the update and the store are done with the interrupts masked */
+	if(Level == STD_HIGH)
+	{
+		/* Write Logic High */
+		DIO_ENTER_CRITICAL_SECTION(Interrupts_State);
+		Dio_OutputShadow[Channel_Ptr->Port_Num] |= Channel_Ptr->Mask;
+		*Channel_Ptr->Data_Ptr = Dio_OutputShadow[Channel_Ptr->Port_Num];
+		DIO_EXIT_CRITICAL_SECTION(Interrupts_State);
+	}
+	else if(Level == STD_LOW)
+	{
+		/* Write Logic Low */
+		DIO_ENTER_CRITICAL_SECTION(Interrupts_State);
+		Dio_OutputShadow[Channel_Ptr->Port_Num] &= (Dio_PortLevelType)~Channel_Ptr->Mask;
+		*Channel_Ptr->Data_Ptr = Dio_OutputShadow[Channel_Ptr->Port_Num];
+		DIO_EXIT_CRITICAL_SECTION(Interrupts_State);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+}
+
+/* Inline body of Dio_ReadChannel without the parameters checking */
+LOCAL_INLINE Dio_LevelType Dio_ReadChannelInline(Dio_ChannelType ChannelId)
+{
+	/* Read the required channel */
+	return (DIO_CHANNEL_READ(&Dio_ChannelDesc[ChannelId]) ? STD_HIGH : STD_LOW);
+}
+
+/* Inline body of Dio_ReadOutputChannel without the parameters checking */
+LOCAL_INLINE Dio_LevelType Dio_ReadOutputChannelInline(Dio_ChannelType ChannelId)
+{
+	/* Read the last written level from RAM */
+	return ((Dio_OutputShadow[Dio_ChannelDesc[ChannelId].Port_Num] & Dio_ChannelDesc[ChannelId].Mask) ? STD_HIGH : STD_LOW);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+/* Inline body of Dio_FlipChannel without the parameters checking */
+LOCAL_INLINE Dio_LevelType Dio_FlipChannelInline(Dio_ChannelType ChannelId)
+{
+	const Dio_ChannelDescType * Channel_Ptr = &Dio_ChannelDesc[ChannelId];
+	Dio_PortLevelType Shadow;
+
+	/* Invert the channel in the port shadow , the current level is never read from the port */
+#if (DIO_BIT_BAND_ACCESS == STD_ON)
+	Shadow = Dio_ShadowUpdate(Channel_Ptr->Port_Num, 0U, Channel_Ptr->Mask);
+	*Channel_Ptr->Data_Ptr = ((Shadow & Channel_Ptr->Mask) ? STD_HIGH : STD_LOW);
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+	/* The aperture store of the new shadow changes only this pin */
+	Shadow = Dio_ShadowUpdate(Channel_Ptr->Port_Num, 0U, Channel_Ptr->Mask);
+	*Channel_Ptr->Data_Ptr = Shadow;
+#else
+	uint32 Interrupts_State;
+
+	DIO_ENTER_CRITICAL_SECTION(Interrupts_State);
+	Dio_OutputShadow[Channel_Ptr->Port_Num] ^= Channel_Ptr->Mask;
+	Shadow = Dio_OutputShadow[Channel_Ptr->Port_Num];
+	*Channel_Ptr->Data_Ptr = Shadow;
+	DIO_EXIT_CRITICAL_SECTION(Interrupts_State);
+#endif
+	return ((Shadow & Channel_Ptr->Mask) ? STD_HIGH : STD_LOW);
+}
+#endif
+
 #endif /* DIO_H */
@@ -35,6 +35,39 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for presence of Dio_MaskedWritePort API */
+#define DIO_MASKED_WRITE_PORT_API           (STD_ON)
+
+/* Pre-compile option for presence of Dio_WriteChannels and Dio_FlipChannels APIs */
+#define DIO_MULTI_CHANNEL_API               (STD_ON)
+
+/* Pre-compile option for presence of Dio ports snapshot APIs */
+#define DIO_SNAPSHOT_API                    (STD_ON)
+
+/* Pre-compile option for presence of Dio_VerifyOutputs and Dio_ResyncOutputs APIs */
+#define DIO_OUTPUTS_VERIFY_API              (STD_ON)
+
+/*
+ * Pre-compile option for GPIODATA address-masked access:
+ * STD_ON  - each write is a single store through the GPIODATA aperture whose address bits [9:2]
+ *           select only the written pins , with no read-back of the port and the interrupts left enabled.
+ *           The output shadow is updated with an exclusive access loop (LDREXB/STREXB) or its bit-band
+ *           alias , a preempting write between the shadow update and the store may leave the shadow and
+ *           the pin apart until the next write of that pin , no write can be lost on the other pins.
+ * STD_OFF - the output shadow is updated then stored to the full GPIODATA register (0x3FC) inside a
+ *           critical section with the IRQ interrupts disabled.
+ * Both accesses are measured by App_ProfileDrivers when APP_PROFILING_API is STD_ON.
+ */
+#define DIO_MASKED_DATA_ACCESS              (STD_ON)
+
+/*
+ * Pre-compile option for Cortex-M4 bit-band access of the channel APIs:
+ * STD_ON  - Dio_Init resolves the bit-band alias word of every channel pin, so Dio_WriteChannel,
+ *           Dio_ReadChannel and Dio_FlipChannel become single word accesses holding only that pin.
+ * STD_OFF - the channel APIs use the GPIODATA access selected by DIO_MASKED_DATA_ACCESS.
+ */
+#define DIO_BIT_BAND_ACCESS                 (STD_OFF)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -42,6 +75,20 @@
 #define DioConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
 #define DioConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
 
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_CHANNEL_GROUPS        (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LEDS_GROUP_ID_INDEX      (uint8)0x00
+
+/* DIO Port ID's to be used with the Dio port APIs */
+#define DioConf_PORTA_PORT_ID                (Dio_PortType)0
+#define DioConf_PORTB_PORT_ID                (Dio_PortType)1
+#define DioConf_PORTC_PORT_ID                (Dio_PortType)2
+#define DioConf_PORTD_PORT_ID                (Dio_PortType)3
+#define DioConf_PORTE_PORT_ID                (Dio_PortType)4
+#define DioConf_PORTF_PORT_ID                (Dio_PortType)5
+
 /* DIO Configured Port ID's  */
 #define DioConf_LED1_PORT_NUM                (Dio_PortType)5 /* PORTF */
 #define DioConf_SW1_PORT_NUM                 (Dio_PortType)5 /* PORTF */
@@ -50,4 +97,29 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* DIO Configured Channel Groups */
+#define DioConf_RGB_LEDS_GROUP_PORT_NUM      (Dio_PortType)5 /* PORTF */
+#define DioConf_RGB_LEDS_GROUP_MASK          (uint8)0x0E     /* Pins 1, 2 and 3 in PORTF */
+#define DioConf_RGB_LEDS_GROUP_OFFSET        (uint8)1
+
+/*
+ * Configured channels and channel groups , expanded by Dio_PBcfg.c into Dio_Configuration
+ * and by its compile time configuration checks:
+ * CHANNEL( Name ) selects DioConf_<Name>_CHANNEL_ID_INDEX , DioConf_<Name>_PORT_NUM and DioConf_<Name>_CHANNEL_NUM.
+ * GROUP( Name ) selects DioConf_<Name>_GROUP_ID_INDEX , DioConf_<Name>_GROUP_PORT_NUM , _MASK and _OFFSET.
+ */
+#define DioConf_CHANNELS(CHANNEL) \
+    CHANNEL( LED1 ) \
+    CHANNEL( SW1 )
+
+#define DioConf_CHANNEL_GROUPS(GROUP) \
+    GROUP( RGB_LEDS )
+
+/* CRC-32 of the channels and channel groups , stored in the image header and checked by Dio_Init.
+ * Generated by "python tools/config_image.py tools/pin_map.json --print-crc" , regenerate it whenever
+ * the channels change or Dio_Init rejects the configuration (DIO_E_PARAM_CONFIG).
+ * The CCS pre-build step (config_image.py --check) fails the build when this CRC or the channels and
+ * channel groups above differ from tools/pin_map.json. */
+#define DioConf_CONFIGURATION_CRC            (0x83F8422AU)
+
 #endif /* DIO_CFG_H */
@@ -11,6 +11,9 @@
 
 #include "Dio.h"
 
+/* Port configuration sets , used by the compile time configuration checks */
+#include "Port.h"
+
 /*
  * Module Version 1.0.0
  */
@@ -39,8 +42,44 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
-/* PB structure used with Dio_Init API */
+/* Channel and channel group rows , placed at their index */
+#define DIO_CHANNEL_INIT(NAME) \
+    [DioConf_##NAME##_CHANNEL_ID_INDEX] = PIN_ID(DioConf_##NAME##_PORT_NUM , DioConf_##NAME##_CHANNEL_NUM),
+#define DIO_GROUP_INIT(NAME) \
+    [DioConf_##NAME##_GROUP_ID_INDEX] = { DioConf_##NAME##_GROUP_MASK , DioConf_##NAME##_GROUP_OFFSET , DioConf_##NAME##_GROUP_PORT_NUM },
+
+/* Compile time checks of the Dio configuration against the Port configuration sets:
+ *  1. every channel and every pin of a channel group is configured in DIO mode by all the Port sets.
+ *  2. the channel group mask is one run of adjoining pins starting at the group offset.
+ *  3. every channel index is used once and all the DIO_CONFIGURED_CHANNLES channels are configured.
+ */
+#define DIO_CHANNEL_IS_DIO_PIN(NAME) \
+    && ((PORT_PIN_KEY(DioConf_##NAME##_PORT_NUM , DioConf_##NAME##_CHANNEL_NUM) & PORT_DIO_PINS_KEY) != 0U) \
+    && (DioConf_##NAME##_PORT_NUM < DIO_PORTS_NUM)
+#define DIO_GROUP_IS_VALID(NAME) \
+    && (DioConf_##NAME##_GROUP_PORT_NUM < DIO_PORTS_NUM) \
+    && ((((uint64)DioConf_##NAME##_GROUP_MASK << ((DioConf_##NAME##_GROUP_PORT_NUM * 8U) & 63U)) & ~PORT_DIO_PINS_KEY) == 0U) \
+    && ((DioConf_##NAME##_GROUP_MASK >> DioConf_##NAME##_GROUP_OFFSET) & 1U) \
+    && ((((DioConf_##NAME##_GROUP_MASK >> DioConf_##NAME##_GROUP_OFFSET) + 1U) & (DioConf_##NAME##_GROUP_MASK >> DioConf_##NAME##_GROUP_OFFSET)) == 0U)
+#define DIO_CHANNEL_INDEX_SUM(NAME)     + ((uint64)1 << (DioConf_##NAME##_CHANNEL_ID_INDEX & 63U))
+#define DIO_CHANNEL_INDEX_OR(NAME)      | ((uint64)1 << (DioConf_##NAME##_CHANNEL_ID_INDEX & 63U))
+#define DIO_CHANNEL_COUNT(NAME)         + 1U
+#define DIO_GROUP_COUNT(NAME)           + 1U
+
+STATIC_ASSERT((1 DioConf_CHANNELS(DIO_CHANNEL_IS_DIO_PIN)) , Dio_Channel_Not_Configured_As_Dio_By_Port) ;
+STATIC_ASSERT((1 DioConf_CHANNEL_GROUPS(DIO_GROUP_IS_VALID)) , Dio_Channel_Group_Invalid) ;
+STATIC_ASSERT(((uint64)0 DioConf_CHANNELS(DIO_CHANNEL_INDEX_SUM)) == ((uint64)0 DioConf_CHANNELS(DIO_CHANNEL_INDEX_OR)) , Dio_Duplicate_Channel_Index) ;
+STATIC_ASSERT((0U DioConf_CHANNELS(DIO_CHANNEL_COUNT)) == DIO_CONFIGURED_CHANNLES , Dio_Channels_Count) ;
+STATIC_ASSERT((0U DioConf_CHANNEL_GROUPS(DIO_GROUP_COUNT)) == DIO_CONFIGURED_CHANNEL_GROUPS , Dio_Channel_Groups_Count) ;
+
+/* The payload directly follows the image header , only the tail padding is left out of the CRC */
+STATIC_ASSERT(sizeof(Dio_ChannelGroupType) == 3U , Dio_Channel_Group_Has_Padding) ;
+STATIC_ASSERT(sizeof(Dio_ConfigType) >= (sizeof(Config_ImageHeaderType) + DIO_CONFIG_IMAGE_LENGTH) , Dio_Config_Image_Length) ;
+
+/* PB structure used with Dio_Init API , in the .dio_config flash section */
+#pragma DATA_SECTION(Dio_Configuration, ".dio_config")
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                             CONFIG_IMAGE_HEADER(DIO , 0U , DIO_CONFIG_IMAGE_LENGTH , DioConf_CONFIGURATION_CRC),
+                                             { DioConf_CHANNELS(DIO_CHANNEL_INIT) },
+                                             { DioConf_CHANNEL_GROUPS(DIO_GROUP_INIT) }
 				                         };
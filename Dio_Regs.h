@@ -14,11 +14,51 @@
 
 #include "Std_Types.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/* The GPIO bus aperture (AHB or APB) is selected by the Port driver configuration */
+#include "Port_Cfg.h"
+
+/* GPIO Ports base addresses */
+#if (PORT_GPIO_AHB_ACCESS == STD_ON)
+/* Advanced High-performance Bus apertures */
+#define DIO_PORTA_BASE_ADDRESS    0x40058000
+#define DIO_PORTB_BASE_ADDRESS    0x40059000
+#define DIO_PORTC_BASE_ADDRESS    0x4005A000
+#define DIO_PORTD_BASE_ADDRESS    0x4005B000
+#define DIO_PORTE_BASE_ADDRESS    0x4005C000
+#define DIO_PORTF_BASE_ADDRESS    0x4005D000
+#else
+/* Advanced Peripheral Bus apertures */
+#define DIO_PORTA_BASE_ADDRESS    0x40004000
+#define DIO_PORTB_BASE_ADDRESS    0x40005000
+#define DIO_PORTC_BASE_ADDRESS    0x40006000
+#define DIO_PORTD_BASE_ADDRESS    0x40007000
+#define DIO_PORTE_BASE_ADDRESS    0x40024000
+#define DIO_PORTF_BASE_ADDRESS    0x40025000
+#endif
+
+/* GPIODATA register offset with all the address mask bits [9:2] set */
+#define DIO_DATA_REG_OFFSET       0x3FC
+
+/* GPIODIR register offset, read by Dio_VerifyOutputs to select the output pins */
+#define DIO_DIR_REG_OFFSET        0x400
+
+/* GPIODATA aperture offset where only the pins set in MASK are affected by a store or returned by a load */
+#define DIO_MASKED_DATA_REG_OFFSET(MASK)   ((uint32)(MASK) << 2)
+
+/* Peripheral bit-band region and its alias region */
+#define DIO_PERIPHERAL_BIT_BAND_BASE       0x40000000
+#define DIO_PERIPHERAL_BIT_BAND_ALIAS_BASE 0x42000000
+
+/* Address of the alias word mapped to bit BIT of the peripheral word at ADDRESS */
+#define DIO_BIT_BAND_ALIAS_ADDRESS(ADDRESS, BIT) \
+    (DIO_PERIPHERAL_BIT_BAND_ALIAS_BASE + (((uint32)(ADDRESS) - DIO_PERIPHERAL_BIT_BAND_BASE) * 32U) + ((uint32)(BIT) * 4U))
+
+/* SRAM bit-band region and its alias region , a store to an alias word is an atomic single bit write */
+#define DIO_SRAM_BIT_BAND_BASE             0x20000000
+#define DIO_SRAM_BIT_BAND_ALIAS_BASE       0x22000000
+
+/* Address of the alias word mapped to bit BIT of the SRAM byte at ADDRESS */
+#define DIO_SRAM_BIT_BAND_ALIAS_ADDRESS(ADDRESS, BIT) \
+    (DIO_SRAM_BIT_BAND_ALIAS_BASE + (((uint32)(ADDRESS) - DIO_SRAM_BIT_BAND_BASE) * 32U) + ((uint32)(BIT) * 4U))
 
 #endif /* DIO_REGS_H */
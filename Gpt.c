@@ -4,17 +4,823 @@
  *
  * File Name: Gpt.c
  *
- * Description: Source file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Source file for TM4C123GH6PM Microcontroller - Gpt Driver over Timer0-5 and WideTimer0-5,
+ *              and the SysTick Timer Driver used by the Os.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
 
 #include "Gpt.h"
+#include "Gpt_Regs.h"
+#include "Mcu.h"
 #include "tm4c123gh6pm_registers.h"
 
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Gpt Modules */
+#if ((DET_AR_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Register at OFFSET of a hardware timer */
+#define GPT_TIMER_REG(TIMER, OFFSET) \
+	(*(volatile uint32 *)(Gpt_TimerBaseAddress[(TIMER)] + (OFFSET)))
+
+/* Bit of a hardware timer in the RCGCTIMER / RCGCWTIMER , SCGCTIMER / SCGCWTIMER and PRTIMER / PRWTIMER registers */
+#define GPT_TIMER_CLOCK_BIT(TIMER)     ((uint32)1 << ((TIMER) % 6U))
+
+/* Hardware timer not used by any channel */
+#define GPT_NO_CHANNEL                 (0xFFU)
+
+/* Channel states */
+#define GPT_CHANNEL_INITIALIZED        (0U)
+#define GPT_CHANNEL_RUNNING            (1U)
+#define GPT_CHANNEL_STOPPED            (2U)
+#define GPT_CHANNEL_EXPIRED            (3U)
+
+STATIC const Gpt_ConfigChannel * Gpt_Channels = NULL_PTR;
+STATIC uint8 Gpt_Status = GPT_NOT_INITIALIZED;
+STATIC Gpt_ModeType Gpt_Mode = GPT_MODE_NORMAL;
+
+/* Timers base addresses indexed by the Timer member of the channels */
+STATIC const uint32 Gpt_TimerBaseAddress[GPT_TIMERS_NUM] =
+{
+	GPT_TIMER0_BASE_ADDRESS, GPT_TIMER1_BASE_ADDRESS, GPT_TIMER2_BASE_ADDRESS,
+	GPT_TIMER3_BASE_ADDRESS, GPT_TIMER4_BASE_ADDRESS, GPT_TIMER5_BASE_ADDRESS,
+	GPT_WIDE_TIMER0_BASE_ADDRESS, GPT_WIDE_TIMER1_BASE_ADDRESS, GPT_WIDE_TIMER2_BASE_ADDRESS,
+	GPT_WIDE_TIMER3_BASE_ADDRESS, GPT_WIDE_TIMER4_BASE_ADDRESS, GPT_WIDE_TIMER5_BASE_ADDRESS
+};
+
+/* NVIC interrupt number of the timer A of every hardware timer */
+STATIC const uint8 Gpt_TimerIrqNumber[GPT_TIMERS_NUM] = { 19 , 21 , 23 , 35 , 70 , 92 , 94 , 96 , 98 , 100 , 102 , 104 } ;
+
+/* Channel using every hardware timer , filled by Gpt_Init for the timer ISRs */
+STATIC uint8 Gpt_TimerChannel[GPT_TIMERS_NUM] =
+{
+	GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL,
+	GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL, GPT_NO_CHANNEL
+};
+
+/* Run time state of every channel , the state and the wakeup events are also written by the timer ISRs */
+STATIC volatile uint8 Gpt_ChannelState[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_TargetTime[GPT_CONFIGURED_CHANNELS];
+STATIC Gpt_ValueType Gpt_StoppedElapsed[GPT_CONFIGURED_CHANNELS];
+STATIC boolean Gpt_NotificationEnabled[GPT_CONFIGURED_CHANNELS];
+STATIC boolean Gpt_WakeupEnabled[GPT_CONFIGURED_CHANNELS];
+STATIC volatile boolean Gpt_WakeupPending[GPT_CONFIGURED_CHANNELS];
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/* High 32 bits of the timestamp , counted by the overflow ISR of the timestamp timer */
+STATIC volatile uint32 Gpt_TimestampHigh = 0U;
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_CheckChannel
+* Parameters (in): Channel - channel to check , ServiceId - API reporting the error
+* Return value: boolean - TRUE when the module is initialized and the channel is valid
+* Description: Development error checks common to the channel APIs.
+************************************************************************************/
+STATIC boolean Gpt_CheckChannel(Gpt_ChannelType Channel, uint8 ServiceId)
+{
+	boolean valid = TRUE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_UNINIT);
+		valid = FALSE;
+	}
+	/* Check if the used channel is within the valid range */
+	else if (GPT_CONFIGURED_CHANNELS <= Channel)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, ServiceId, GPT_E_PARAM_CHANNEL);
+		valid = FALSE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	return valid;
+}
+
+/************************************************************************************
+* Service Name: Gpt_UpdateInterrupt
+* Parameters (in): Channel - channel to update
+* Return value: None
+* Description: The time-out interrupt of a channel is only unmasked when its notification
+*              or its wakeup is enabled , a one-shot expiry is otherwise read back from TAEN.
+************************************************************************************/
+STATIC void Gpt_UpdateInterrupt(Gpt_ChannelType Channel)
+{
+	Gpt_TimerType Timer = Gpt_Channels[Channel].Timer;
+
+	GPT_TIMER_REG(Timer, GPT_IMR_REG_OFFSET) =
+		((TRUE == Gpt_NotificationEnabled[Channel]) || (TRUE == Gpt_WakeupEnabled[Channel])) ? GPT_INT_TATO : 0U;
+}
+
+/************************************************************************************
+* Service Name: Gpt_Elapsed
+* Parameters (in): Channel - channel to read
+* Return value: Gpt_ValueType - ticks elapsed since the channel start or its last period
+* Description: Reads the counter of a running channel and moves an expired one-shot
+*              channel to the expired state.
+************************************************************************************/
+STATIC Gpt_ValueType Gpt_Elapsed(Gpt_ChannelType Channel)
+{
+	Gpt_TimerType Timer = Gpt_Channels[Channel].Timer;
+	Gpt_ValueType Elapsed = 0;
+
+	if (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+	{
+		/* The hardware clears TAEN when a one-shot channel times out */
+		if ((GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].Mode)
+		 && (0U == (GPT_TIMER_REG(Timer, GPT_CTL_REG_OFFSET) & GPT_CTL_TAEN)))
+		{
+			Gpt_ChannelState[Channel] = GPT_CHANNEL_EXPIRED;
+			Elapsed = Gpt_TargetTime[Channel];
+		}
+		else
+		{
+			/* The counter goes down from (target - 1) , the prescaler sits above it in TAV of Timer0-5 */
+			Elapsed = (Gpt_TargetTime[Channel] - 1U)
+			        - (GPT_TIMER_REG(Timer, GPT_TAV_REG_OFFSET) & GPT_COUNTER_MAX(Timer));
+		}
+	}
+	else if (GPT_CHANNEL_STOPPED == Gpt_ChannelState[Channel])
+	{
+		Elapsed = Gpt_StoppedElapsed[Channel];
+	}
+	else if (GPT_CHANNEL_EXPIRED == Gpt_ChannelState[Channel])
+	{
+		Elapsed = Gpt_TargetTime[Channel];
+	}
+	else
+	{
+		/* Never started */
+	}
+	return Elapsed;
+}
+
+/************************************************************************************
+* Service Name: Gpt_TimeoutInterrupt
+* Parameters (in): Timer - hardware timer raising the time-out interrupt
+* Return value: None
+* Description: Common body of the timer ISRs : clears the time-out , records the one-shot
+*              expiry and the wakeup event in sleep mode and calls the channel notification ,
+*              or counts the overflow of the timestamp timer.
+************************************************************************************/
+LOCAL_INLINE void Gpt_TimeoutInterrupt(Gpt_TimerType Timer)
+{
+	uint8 Channel = Gpt_TimerChannel[Timer];
+
+	GPT_TIMER_REG(Timer, GPT_ICR_REG_OFFSET) = GPT_INT_TATO;
+#if (GPT_TIMESTAMP_API == STD_ON)
+	/* Timer is a constant in every ISR , only the ISR of the timestamp timer keeps this test */
+	if (GPT_TIMESTAMP_TIMER == Timer)
+	{
+		Gpt_TimestampHigh++;
+	}
+	else
+#endif
+	if (GPT_NO_CHANNEL != Channel)
+	{
+		if (GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].Mode)
+		{
+			Gpt_ChannelState[Channel] = GPT_CHANNEL_EXPIRED;
+		}
+		if ((GPT_MODE_SLEEP == Gpt_Mode) && (TRUE == Gpt_WakeupEnabled[Channel]))
+		{
+			Gpt_WakeupPending[Channel] = TRUE;
+		}
+		if ((TRUE == Gpt_NotificationEnabled[Channel]) && (NULL_PTR != Gpt_Channels[Channel].Notification))
+		{
+			Gpt_Channels[Channel].Notification();
+		}
+	}
+}
+
+/* Time-out ISRs of the timer A of every hardware timer */
+void Timer0A_Handler(void)     { Gpt_TimeoutInterrupt(GPT_TIMER_0); }
+void Timer1A_Handler(void)     { Gpt_TimeoutInterrupt(GPT_TIMER_1); }
+void Timer2A_Handler(void)     { Gpt_TimeoutInterrupt(GPT_TIMER_2); }
+void Timer3A_Handler(void)     { Gpt_TimeoutInterrupt(GPT_TIMER_3); }
+void Timer4A_Handler(void)     { Gpt_TimeoutInterrupt(GPT_TIMER_4); }
+void Timer5A_Handler(void)     { Gpt_TimeoutInterrupt(GPT_TIMER_5); }
+void WideTimer0A_Handler(void) { Gpt_TimeoutInterrupt(GPT_WIDE_TIMER_0); }
+void WideTimer1A_Handler(void) { Gpt_TimeoutInterrupt(GPT_WIDE_TIMER_1); }
+void WideTimer2A_Handler(void) { Gpt_TimeoutInterrupt(GPT_WIDE_TIMER_2); }
+void WideTimer3A_Handler(void) { Gpt_TimeoutInterrupt(GPT_WIDE_TIMER_3); }
+void WideTimer4A_Handler(void) { Gpt_TimeoutInterrupt(GPT_WIDE_TIMER_4); }
+void WideTimer5A_Handler(void) { Gpt_TimeoutInterrupt(GPT_WIDE_TIMER_5); }
+
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module:
+*              - Enable the clock of the used timers
+*              - Split every used timer and program the timer A mode and prescaler
+*              - Enable the timer A NVIC interrupt , the time-out stays masked in the timer
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID,
+		     GPT_E_PARAM_POINTER);
+	}
+	else if (GPT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_INIT_SID,
+		     GPT_E_ALREADY_INITIALIZED);
+	}
+	else
+#endif
+	{
+		Gpt_ChannelType Channel;
+
+		Gpt_Channels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		Gpt_Mode     = GPT_MODE_NORMAL;
+
+		for(Channel = 0; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+		{
+			Gpt_TimerType Timer = Gpt_Channels[Channel].Timer;
+			uint8 Irq = Gpt_TimerIrqNumber[Timer];
+
+			/* Enable the clock of the timer and wait until it is ready */
+			if (GPT_IS_WIDE_TIMER(Timer))
+			{
+				SYSCTL_RCGCWTIMER_REG |= GPT_TIMER_CLOCK_BIT(Timer);
+				while(0U == (SYSCTL_PRWTIMER_REG & GPT_TIMER_CLOCK_BIT(Timer)));
+			}
+			else
+			{
+				SYSCTL_RCGCTIMER_REG |= GPT_TIMER_CLOCK_BIT(Timer);
+				while(0U == (SYSCTL_PRTIMER_REG & GPT_TIMER_CLOCK_BIT(Timer)));
+			}
+
+			/* Timer A alone , counting down every (Prescaler + 1) core clocks */
+			GPT_TIMER_REG(Timer, GPT_CTL_REG_OFFSET)  = GPT_CTL_TASTALL;
+			GPT_TIMER_REG(Timer, GPT_CFG_REG_OFFSET)  = GPT_CFG_SPLIT;
+			GPT_TIMER_REG(Timer, GPT_TAMR_REG_OFFSET) =
+				(GPT_CH_MODE_ONESHOT == Gpt_Channels[Channel].Mode) ? GPT_TAMR_ONESHOT : GPT_TAMR_PERIODIC;
+			GPT_TIMER_REG(Timer, GPT_TAPR_REG_OFFSET) = Gpt_Channels[Channel].Prescaler;
+			GPT_TIMER_REG(Timer, GPT_IMR_REG_OFFSET)  = 0U;
+			GPT_TIMER_REG(Timer, GPT_ICR_REG_OFFSET)  = GPT_INT_TATO;
+			(&NVIC_EN0_REG)[Irq >> 5] = ((uint32)1 << (Irq & 31U));
+
+			Gpt_TimerChannel[Timer]            = Channel;
+			Gpt_ChannelState[Channel]          = GPT_CHANNEL_INITIALIZED;
+			Gpt_TargetTime[Channel]            = 0U;
+			Gpt_StoppedElapsed[Channel]        = 0U;
+			Gpt_NotificationEnabled[Channel]   = FALSE;
+			Gpt_WakeupEnabled[Channel]         = FALSE;
+			Gpt_WakeupPending[Channel]         = FALSE;
+		}
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+		/* Timestamp timer : timer A counting up at the core clock through the full 32 bits ,
+		 * its overflow interrupt counts the high 32 bits */
+		{
+			uint8 Irq = Gpt_TimerIrqNumber[GPT_TIMESTAMP_TIMER];
+
+			SYSCTL_RCGCWTIMER_REG |= GPT_TIMER_CLOCK_BIT(GPT_TIMESTAMP_TIMER);
+			/* Keep it clocked in the sleep mode too , the idle cycles are counted across WFI */
+			SYSCTL_SCGCWTIMER_REG |= GPT_TIMER_CLOCK_BIT(GPT_TIMESTAMP_TIMER);
+			while(0U == (SYSCTL_PRWTIMER_REG & GPT_TIMER_CLOCK_BIT(GPT_TIMESTAMP_TIMER)));
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_CTL_REG_OFFSET)   = 0U;
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_CFG_REG_OFFSET)   = GPT_CFG_SPLIT;
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_TAMR_REG_OFFSET)  = GPT_TAMR_PERIODIC | GPT_TAMR_TACDIR_UP;
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_TAPR_REG_OFFSET)  = 0U;
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_TAILR_REG_OFFSET) = 0xFFFFFFFFU;
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_ICR_REG_OFFSET)   = GPT_INT_TATO;
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_IMR_REG_OFFSET)   = GPT_INT_TATO;
+			Gpt_TimestampHigh = 0U;
+			(&NVIC_EN0_REG)[Irq >> 5] = ((uint32)1 << (Irq & 31U));
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_CTL_REG_OFFSET)   = GPT_CTL_TAEN;
+		}
+#endif
+		Gpt_Status = GPT_INITIALIZED;
+	}
+}
+
+#if (GPT_DEINIT_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to return the used timers to their reset state and gate their clock ,
+*              refused with GPT_E_BUSY while a channel is running.
+************************************************************************************/
+void Gpt_DeInit(void)
+{
+	Gpt_ChannelType Channel;
+	boolean error = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID,
+				GPT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		for(Channel = 0; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+		{
+			/* Refresh the state of the one-shot channels already expired */
+			(void)Gpt_Elapsed(Channel);
+			if (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+			{
+				Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DEINIT_SID,
+						GPT_E_BUSY);
+				error = TRUE;
+				break;
+			}
+		}
+	}
+#endif
+
+	if(FALSE == error)
+	{
+		for(Channel = 0; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+		{
+			Gpt_TimerType Timer = Gpt_Channels[Channel].Timer;
+			uint8 Irq = Gpt_TimerIrqNumber[Timer];
+
+			(&NVIC_DIS0_REG)[Irq >> 5] = ((uint32)1 << (Irq & 31U));
+			GPT_TIMER_REG(Timer, GPT_CTL_REG_OFFSET)   = 0U;
+			GPT_TIMER_REG(Timer, GPT_IMR_REG_OFFSET)   = 0U;
+			GPT_TIMER_REG(Timer, GPT_ICR_REG_OFFSET)   = GPT_INT_TATO;
+			GPT_TIMER_REG(Timer, GPT_CFG_REG_OFFSET)   = 0U;
+			GPT_TIMER_REG(Timer, GPT_TAMR_REG_OFFSET)  = 0U;
+			GPT_TIMER_REG(Timer, GPT_TAPR_REG_OFFSET)  = 0U;
+			GPT_TIMER_REG(Timer, GPT_TAILR_REG_OFFSET) = 0xFFFFFFFFU;
+			if (GPT_IS_WIDE_TIMER(Timer))
+			{
+				SYSCTL_RCGCWTIMER_REG &= ~GPT_TIMER_CLOCK_BIT(Timer);
+			}
+			else
+			{
+				SYSCTL_RCGCTIMER_REG &= ~GPT_TIMER_CLOCK_BIT(Timer);
+			}
+			Gpt_TimerChannel[Timer] = GPT_NO_CHANNEL;
+		}
+#if (GPT_TIMESTAMP_API == STD_ON)
+		{
+			uint8 Irq = Gpt_TimerIrqNumber[GPT_TIMESTAMP_TIMER];
+
+			(&NVIC_DIS0_REG)[Irq >> 5] = ((uint32)1 << (Irq & 31U));
+			GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_CTL_REG_OFFSET) = 0U;
+			SYSCTL_RCGCWTIMER_REG &= ~GPT_TIMER_CLOCK_BIT(GPT_TIMESTAMP_TIMER);
+		}
+#endif
+		Gpt_Status   = GPT_NOT_INITIALIZED;
+		Gpt_Channels = NULL_PTR;
+	}
+}
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks elapsed.
+* Description: Returns the ticks elapsed since the channel start (one-shot) or since its
+*              last period (continuous) , the target time once a one-shot channel expired.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel)
+{
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_GET_TIME_ELAPSED_SID))
+	{
+		return 0U;
+	}
+	return Gpt_Elapsed(Channel);
+}
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks remaining.
+* Description: Returns the ticks remaining until the target time , 0 for a channel never
+*              started or an expired one-shot channel.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType Elapsed;
+
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_GET_TIME_REMAINING_SID))
+	{
+		return 0U;
+	}
+	Elapsed = Gpt_Elapsed(Channel);
+	return (GPT_CHANNEL_INITIALIZED == Gpt_ChannelState[Channel]) ? 0U : (Gpt_TargetTime[Channel] - Elapsed);
+}
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+*                  Value - Target time in number of ticks.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Loads (Value - 1) in the timer A and starts it.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value)
+{
+	Gpt_TimerType Timer;
+
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_START_TIMER_SID))
+	{
+		return;
+	}
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if ((0U == Value) || (Value > Gpt_Channels[Channel].Tick_Value_Max))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID,
+				GPT_E_PARAM_VALUE);
+		return;
+	}
+	(void)Gpt_Elapsed(Channel);
+	if (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_START_TIMER_SID,
+				GPT_E_BUSY);
+		return;
+	}
+#endif
+
+	Timer = Gpt_Channels[Channel].Timer;
+	GPT_TIMER_REG(Timer, GPT_CTL_REG_OFFSET)  &= ~GPT_CTL_TAEN;
+	GPT_TIMER_REG(Timer, GPT_TAILR_REG_OFFSET) = Value - 1U;
+	GPT_TIMER_REG(Timer, GPT_ICR_REG_OFFSET)   = GPT_INT_TATO;
+	Gpt_TargetTime[Channel]   = Value;
+	Gpt_ChannelState[Channel] = GPT_CHANNEL_RUNNING;
+	GPT_TIMER_REG(Timer, GPT_CTL_REG_OFFSET)  |= GPT_CTL_TAEN;
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Stops a running channel and keeps its elapsed time , an expired one-shot
+*              channel or a stopped channel is left as it is.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel)
+{
+	Gpt_ValueType Elapsed;
+
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_STOP_TIMER_SID))
+	{
+		return;
+	}
+	Elapsed = Gpt_Elapsed(Channel);
+	if (GPT_CHANNEL_RUNNING == Gpt_ChannelState[Channel])
+	{
+		GPT_TIMER_REG(Gpt_Channels[Channel].Timer, GPT_CTL_REG_OFFSET) &= ~GPT_CTL_TAEN;
+		Gpt_StoppedElapsed[Channel] = Elapsed;
+		Gpt_ChannelState[Channel]   = GPT_CHANNEL_STOPPED;
+	}
+}
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enables the notification of a channel configured with a notification.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel)
+{
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_ENABLE_NOTIFICATION_SID))
+	{
+		return;
+	}
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (NULL_PTR == Gpt_Channels[Channel].Notification)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_NOTIFICATION_SID,
+				GPT_E_PARAM_CHANNEL);
+		return;
+	}
+#endif
+	Gpt_NotificationEnabled[Channel] = TRUE;
+	Gpt_UpdateInterrupt(Channel);
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Disables the notification of a channel configured with a notification.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel)
+{
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_DISABLE_NOTIFICATION_SID))
+	{
+		return;
+	}
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (NULL_PTR == Gpt_Channels[Channel].Notification)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_NOTIFICATION_SID,
+				GPT_E_PARAM_CHANNEL);
+		return;
+	}
+#endif
+	Gpt_NotificationEnabled[Channel] = FALSE;
+	Gpt_UpdateInterrupt(Channel);
+}
+#endif
+
+#if (GPT_WAKEUP_FUNCTIONALITY_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_SetMode
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Mode - GPT_MODE_NORMAL or GPT_MODE_SLEEP.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Entering the sleep mode stops the channels without wakeup enabled and
+*              keeps only the timers of the wakeup channels clocked in the sleep mode
+*              clock gating registers (SCGCTIMER / SCGCWTIMER). The stopped channels
+*              stay stopped when the normal mode is restored.
+*              The SCGC registers gate the clocks only once RCC.ACG is set , Gpt leaves
+*              ACG to the Mcu configuration. The timestamp timer is kept clocked in the
+*              sleep mode by Gpt_Init and is never used by a channel , so it is never gated.
+************************************************************************************/
+void Gpt_SetMode(Gpt_ModeType Mode)
+{
+	Gpt_ChannelType Channel;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SET_MODE_SID,
+				GPT_E_UNINIT);
+		return;
+	}
+	if ((GPT_MODE_NORMAL != Mode) && (GPT_MODE_SLEEP != Mode))
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SET_MODE_SID,
+				GPT_E_PARAM_MODE);
+		return;
+	}
+#endif
+
+	if (GPT_MODE_SLEEP == Mode)
+	{
+		for(Channel = 0; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+		{
+			Gpt_TimerType Timer = Gpt_Channels[Channel].Timer;
+			volatile uint32 * Sleep_Clock_Gating = GPT_IS_WIDE_TIMER(Timer) ? &SYSCTL_SCGCWTIMER_REG : &SYSCTL_SCGCTIMER_REG;
+
+			if (TRUE == Gpt_WakeupEnabled[Channel])
+			{
+				*Sleep_Clock_Gating |= GPT_TIMER_CLOCK_BIT(Timer);
+			}
+			else
+			{
+				Gpt_StopTimer(Channel);
+				*Sleep_Clock_Gating &= ~GPT_TIMER_CLOCK_BIT(Timer);
+			}
+		}
+	}
+	Gpt_Mode = Mode;
+}
+
+/************************************************************************************
+* Service Name: Gpt_DisableWakeup
+* Service ID[hex]: 0x0A
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Disables the wakeup of a channel configured with a wakeup source.
+************************************************************************************/
+void Gpt_DisableWakeup(Gpt_ChannelType Channel)
+{
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_DISABLE_WAKEUP_SID))
+	{
+		return;
+	}
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (0U == Gpt_Channels[Channel].Wakeup_Source)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_DISABLE_WAKEUP_SID,
+				GPT_E_PARAM_CHANNEL);
+		return;
+	}
+#endif
+	Gpt_WakeupEnabled[Channel] = FALSE;
+	Gpt_UpdateInterrupt(Channel);
+}
+
+/************************************************************************************
+* Service Name: Gpt_EnableWakeup
+* Service ID[hex]: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enables the wakeup of a channel configured with a wakeup source.
+************************************************************************************/
+void Gpt_EnableWakeup(Gpt_ChannelType Channel)
+{
+	if (FALSE == Gpt_CheckChannel(Channel, GPT_ENABLE_WAKEUP_SID))
+	{
+		return;
+	}
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (0U == Gpt_Channels[Channel].Wakeup_Source)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_ENABLE_WAKEUP_SID,
+				GPT_E_PARAM_CHANNEL);
+		return;
+	}
+#endif
+	Gpt_WakeupEnabled[Channel] = TRUE;
+	Gpt_UpdateInterrupt(Channel);
+}
+
+/************************************************************************************
+* Service Name: Gpt_CheckWakeup
+* Service ID[hex]: 0x0C
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): WakeupSource - Wakeup source bits to check.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when a channel of these sources timed out in sleep mode.
+* Description: Checks and clears the wakeup events of the channels of the sources.
+************************************************************************************/
+boolean Gpt_CheckWakeup(Gpt_WakeupSourceType WakeupSource)
+{
+	Gpt_ChannelType Channel;
+	boolean Woken = FALSE;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_CHECK_WAKEUP_SID,
+				GPT_E_UNINIT);
+		return FALSE;
+	}
+#endif
+
+	for(Channel = 0; Channel < GPT_CONFIGURED_CHANNELS; Channel++)
+	{
+		if ((0U != (Gpt_Channels[Channel].Wakeup_Source & WakeupSource)) && (TRUE == Gpt_WakeupPending[Channel]))
+		{
+			Gpt_WakeupPending[Channel] = FALSE;
+			Woken = TRUE;
+		}
+	}
+	return Woken;
+}
+#endif
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimestamp
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Core clock cycles since Gpt_Init.
+* Description: Reads the high word , the counter and the high word again without masking
+*              the interrupts , and retries when the overflow ISR ran in between.
+*              An overflow already raised but not yet served (read from an ISR of the same
+*              priority or with the interrupts masked) is added from the raw status when the
+*              counter shows it wrapped , so the timestamp never goes back. The timestamp
+*              ISR shall keep the highest priority so it is never preempted by a reader.
+************************************************************************************/
+uint64 Gpt_GetTimestamp(void)
+{
+	uint32 High;
+	uint32 Low;
+	uint32 Overflow;
+
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* The timestamp timer is not clocked before Gpt_Init , reading it would fault */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_TIMESTAMP_SID,
+				GPT_E_UNINIT);
+		return 0U;
+	}
+#endif
+
+	do
+	{
+		High     = Gpt_TimestampHigh;
+		Low      = GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_TAV_REG_OFFSET);
+		Overflow = GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_RIS_REG_OFFSET) & GPT_INT_TATO;
+	} while (High != Gpt_TimestampHigh);
+
+	/* Pending overflow : it belongs to this read only if the counter already wrapped */
+	if ((0U != Overflow) && (Low < 0x80000000U))
+	{
+		High++;
+	}
+	return ((uint64)High << 32) | Low;
+}
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestampLow
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Low 32 bits of the timestamp.
+* Description: Single load of the timestamp counter , meant for short durations measured
+*              with unsigned 32-bit differences. Shall not be called before Gpt_Init.
+************************************************************************************/
+uint32 Gpt_GetTimestampLow(void)
+{
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+	/* The timestamp timer is not clocked before Gpt_Init , reading it would fault */
+	if (GPT_NOT_INITIALIZED == Gpt_Status)
+	{
+		Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_GET_TIMESTAMP_LOW_SID,
+				GPT_E_UNINIT);
+		return 0U;
+	}
+#endif
+
+	return GPT_TIMER_REG(GPT_TIMESTAMP_TIMER, GPT_TAV_REG_OFFSET);
+}
+#endif
+
+/*******************************************************************************
+ *                      SysTick Timer Driver used by the Os                    *
+ *******************************************************************************/
+
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
+#define SYSTICK_RELOAD_MAX          0x00FFFFFFU
 
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
@@ -44,13 +850,27 @@ void SysTick_Handler(void)
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
 *              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Enable SysTick Timer with the System clock given by Mcu_GetCoreFrequency
 *              - Enable SysTick Timer Interrupt and set its priority
+*              A Tick_Time of 0 or above the 24-bit reload (209 ms at 80 MHz) is reported
+*              with GPT_E_PARAM_VALUE and the SysTick Timer is not started.
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
+    uint32 Ticks_Per_Ms = Mcu_GetCoreFrequency() / 1000U;
+
+    /* The reload value (Ticks_Per_Ms * Tick_Time) - 1 shall fit in the 24-bit reload register ,
+     * the limit is checked by a division so the product never overflows */
+    if((0U == Tick_Time) || (Tick_Time > ((SYSTICK_RELOAD_MAX + 1U) / Ticks_Per_Ms)))
+    {
+#if (GPT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(GPT_MODULE_ID, GPT_INSTANCE_ID, GPT_SYSTICK_START_SID, GPT_E_PARAM_VALUE);
+#endif
+        return;
+    }
+
     SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
+    SYSTICK_RELOAD_REG  = (Ticks_Per_Ms * Tick_Time) - 1U; /* Set the Reload value to count n miliseconds */
     SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
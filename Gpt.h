@@ -4,7 +4,8 @@
  *
  * File Name: Gpt.h
  *
- * Description: Header file for TM4C123GH6PM Microcontroller - SysTick Timer Driver.
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver over Timer0-5 and WideTimer0-5,
+ *              and the SysTick Timer Driver used by the Os.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
@@ -12,12 +13,429 @@
 #ifndef GPT_H
 #define GPT_H
 
+/* Id for the company in the AUTOSAR */
+#define GPT_VENDOR_ID    (1000U)
+
+/* Gpt Module Id */
+#define GPT_MODULE_ID    (100U)
+
+/* Gpt Instance Id */
+#define GPT_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_SW_MAJOR_VERSION           (1U)
+#define GPT_SW_MINOR_VERSION           (0U)
+#define GPT_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_AR_RELEASE_MAJOR_VERSION   (4U)
+#define GPT_AR_RELEASE_MINOR_VERSION   (0U)
+#define GPT_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Standard AUTOSAR types */
 #include "Std_Types.h"
 
+/* AUTOSAR checking between Std Types and Gpt Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Gpt Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* AUTOSAR Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_CFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_Cfg.h and Gpt.h files */
+#if ((GPT_CFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_CFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_CFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of Gpt_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Gpt Init */
+#define GPT_INIT_SID                   (uint8)0x01
+
+/* Service ID for Gpt DeInit */
+#define GPT_DEINIT_SID                 (uint8)0x02
+
+/* Service ID for Gpt GetTimeElapsed */
+#define GPT_GET_TIME_ELAPSED_SID       (uint8)0x03
+
+/* Service ID for Gpt GetTimeRemaining */
+#define GPT_GET_TIME_REMAINING_SID     (uint8)0x04
+
+/* Service ID for Gpt StartTimer */
+#define GPT_START_TIMER_SID            (uint8)0x05
+
+/* Service ID for Gpt StopTimer */
+#define GPT_STOP_TIMER_SID             (uint8)0x06
+
+/* Service ID for Gpt EnableNotification */
+#define GPT_ENABLE_NOTIFICATION_SID    (uint8)0x07
+
+/* Service ID for Gpt DisableNotification */
+#define GPT_DISABLE_NOTIFICATION_SID   (uint8)0x08
+
+/* Service ID for Gpt SetMode */
+#define GPT_SET_MODE_SID               (uint8)0x09
+
+/* Service ID for Gpt DisableWakeup */
+#define GPT_DISABLE_WAKEUP_SID         (uint8)0x0A
+
+/* Service ID for Gpt EnableWakeup */
+#define GPT_ENABLE_WAKEUP_SID          (uint8)0x0B
+
+/* Service ID for Gpt CheckWakeup */
+#define GPT_CHECK_WAKEUP_SID           (uint8)0x0C
+
+/* Service ID for Gpt GetTimestamp (Not exist in AUTOSAR 4.0.3 GPT SWS Document) */
+#define GPT_GET_TIMESTAMP_SID          (uint8)0x10
+
+/* Service ID for SysTick Start (Not exist in AUTOSAR 4.0.3 GPT SWS Document) */
+#define GPT_SYSTICK_START_SID          (uint8)0x11
+
+/* Service ID for Gpt GetTimestampLow (Not exist in AUTOSAR 4.0.3 GPT SWS Document) */
+#define GPT_GET_TIMESTAMP_LOW_SID      (uint8)0x12
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* API service called without module initialization */
+#define GPT_E_UNINIT                   (uint8)0x0A
+
+/* Gpt_StartTimer called on a running channel */
+#define GPT_E_BUSY                     (uint8)0x0B
+
+/* API service not allowed in the current mode (wakeup services in normal mode) */
+#define GPT_E_MODE                     (uint8)0x0C
+
+/* Gpt_Init called while the module is already initialized */
+#define GPT_E_ALREADY_INITIALIZED      (uint8)0x0D
+
+/* Invalid channel , or a channel without notification or wakeup capability */
+#define GPT_E_PARAM_CHANNEL            (uint8)0x14
+
+/* Gpt_StartTimer called with 0 or a value above the channel tick value max */
+#define GPT_E_PARAM_VALUE              (uint8)0x15
+
+/* Gpt_Init called with a NULL pointer */
+#define GPT_E_PARAM_POINTER            (uint8)0x16
+
+/* Gpt_SetMode called with an invalid mode */
+#define GPT_E_PARAM_MODE               (uint8)0x1F
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Gpt Status */
+#define GPT_INITIALIZED                (1U)
+#define GPT_NOT_INITIALIZED            (0U)
+
+/* Number of the hardware timers : Timer0-5 then WideTimer0-5 */
+#define GPT_TIMERS_NUM                 (12U)
+
+/* Counter and prescaler widths of the split (timer A only) mode used by every channel */
+#define GPT_TIMER_COUNTER_MAX          (0xFFFFU)
+#define GPT_TIMER_PRESCALER_MAX        (0xFFU)
+#define GPT_WIDE_TIMER_COUNTER_MAX     (0xFFFFFFFFU)
+#define GPT_WIDE_TIMER_PRESCALER_MAX   (0xFFFFU)
+
+/* Hardware timer ids , Timer0-5 are 16-bit and WideTimer0-5 are 32-bit counters */
+#define GPT_TIMER_0                    (0U)
+#define GPT_TIMER_1                    (1U)
+#define GPT_TIMER_2                    (2U)
+#define GPT_TIMER_3                    (3U)
+#define GPT_TIMER_4                    (4U)
+#define GPT_TIMER_5                    (5U)
+#define GPT_WIDE_TIMER_0               (6U)
+#define GPT_WIDE_TIMER_1               (7U)
+#define GPT_WIDE_TIMER_2               (8U)
+#define GPT_WIDE_TIMER_3               (9U)
+#define GPT_WIDE_TIMER_4               (10U)
+#define GPT_WIDE_TIMER_5               (11U)
+
+/* Maximum counter and prescaler values of a hardware timer */
+#define GPT_IS_WIDE_TIMER(TIMER)       ((TIMER) >= GPT_WIDE_TIMER_0)
+#define GPT_COUNTER_MAX(TIMER)         (GPT_IS_WIDE_TIMER(TIMER) ? GPT_WIDE_TIMER_COUNTER_MAX : GPT_TIMER_COUNTER_MAX)
+#define GPT_PRESCALER_MAX(TIMER)       (GPT_IS_WIDE_TIMER(TIMER) ? GPT_WIDE_TIMER_PRESCALER_MAX : GPT_TIMER_PRESCALER_MAX)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Numeric ID of a GPT channel */
+typedef uint8 Gpt_ChannelType;
+
+/* Number of timer ticks */
+typedef uint32 Gpt_ValueType;
+
+/* Hardware timer of a channel , GPT_TIMER_0 .. GPT_WIDE_TIMER_5 */
+typedef uint8 Gpt_TimerType;
+
+/* Wakeup source bits of the channels able to wake up the Mcu */
+typedef uint32 Gpt_WakeupSourceType;
+
+/* Notification callback of a channel */
+typedef void (*Gpt_NotificationType)(void);
+
+/* Modes of the GPT driver */
+typedef enum
+{
+	GPT_MODE_NORMAL, GPT_MODE_SLEEP
+} Gpt_ModeType;
+
+/* Behavior of a channel when it reaches the target time */
+typedef enum
+{
+	GPT_CH_MODE_CONTINUOUS, GPT_CH_MODE_ONESHOT
+} Gpt_ChannelModeType;
+
+/* Configuration of a GPT channel */
+typedef struct
+{
+	Gpt_TimerType Timer;
+	Gpt_ChannelModeType Mode;
+	uint16 Prescaler;
+	Gpt_ValueType Tick_Value_Max;
+	Gpt_NotificationType Notification;
+	Gpt_WakeupSourceType Wakeup_Source;
+} Gpt_ConfigChannel;
+
+/* Data Structure required for initializing the Gpt Driver */
+typedef struct
+{
+	Gpt_ConfigChannel Channels[GPT_CONFIGURED_CHANNELS];
+} Gpt_ConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
+/************************************************************************************
+* Service Name: Gpt_Init
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Gpt module , the channels are stopped with
+*              their notification and wakeup disabled.
+************************************************************************************/
+void Gpt_Init(const Gpt_ConfigType * ConfigPtr);
+
+#if (GPT_DEINIT_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_DeInit
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop the channels and return the used timers to their reset state.
+************************************************************************************/
+void Gpt_DeInit(void);
+#endif
+
+#if (GPT_TIME_ELAPSED_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeElapsed
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks elapsed since the channel was started or since its last period.
+* Description: Returns the time already elapsed , frozen while the channel is stopped.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_TIME_REMAINING_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimeRemaining
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_ValueType - Ticks remaining until the target time.
+* Description: Returns the time remaining until the target time is reached.
+************************************************************************************/
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+#endif
+
+/************************************************************************************
+* Service Name: Gpt_StartTimer
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+*                  Value - Target time in number of ticks.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Starts the channel counting down from Value.
+************************************************************************************/
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/************************************************************************************
+* Service Name: Gpt_StopTimer
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Stops the channel , the elapsed time is kept until the next start.
+************************************************************************************/
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enables the notification of the channel when its target time is reached.
+************************************************************************************/
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_DisableNotification
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Disables the notification of the channel.
+************************************************************************************/
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+#endif
+
+#if (GPT_WAKEUP_FUNCTIONALITY_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_SetMode
+* Service ID[hex]: 0x09
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Mode - GPT_MODE_NORMAL or GPT_MODE_SLEEP.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: In sleep mode only the channels with the wakeup enabled keep running ,
+*              the other channels are stopped and their timers are gated in the sleep
+*              mode clock gating registers , which take effect only when RCC.ACG is set.
+*              The timestamp timer stays clocked in the sleep mode.
+************************************************************************************/
+void Gpt_SetMode(Gpt_ModeType Mode);
+
+/************************************************************************************
+* Service Name: Gpt_DisableWakeup
+* Service ID[hex]: 0x0A
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Disables the wakeup of the channel in sleep mode.
+************************************************************************************/
+void Gpt_DisableWakeup(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_EnableWakeup
+* Service ID[hex]: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (but not for the same channel)
+* Parameters (in): Channel - Numeric identifier of the GPT channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Enables the wakeup of the channel in sleep mode.
+************************************************************************************/
+void Gpt_EnableWakeup(Gpt_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Gpt_CheckWakeup
+* Service ID[hex]: 0x0C
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): WakeupSource - Wakeup source bits to check.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when a channel of these sources timed out in sleep mode.
+* Description: Checks and clears the pending wakeup events of the sources.
+*              There is no EcuM in this project , so the event is returned to the
+*              caller instead of being set by EcuM_SetWakeupEvent.
+************************************************************************************/
+boolean Gpt_CheckWakeup(Gpt_WakeupSourceType WakeupSource);
+#endif
+
+#if (GPT_TIMESTAMP_API == STD_ON)
+/************************************************************************************
+* Service Name: Gpt_GetTimestamp
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Core clock cycles since Gpt_Init.
+* Description: Monotonic 64-bit timestamp at the core clock (Mcu_GetCoreFrequency ticks per
+*              second) , lock-free and callable from any task or ISR.
+************************************************************************************/
+uint64 Gpt_GetTimestamp(void);
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestampLow
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Low 32 bits of the timestamp.
+* Description: Single load of the timestamp counter , the difference of two reads is the
+*              duration between them as long as it is below 2^32 cycles (53 s at 80 MHz).
+************************************************************************************/
+uint32 Gpt_GetTimestampLow(void);
+#endif
+
+/*******************************************************************************
+ *                      SysTick Timer Services used by the Os                  *
+ *******************************************************************************/
+
 /************************************************************************************
 * Service Name: SysTick_Start
 * Sync/Async: Synchronous
@@ -28,8 +446,10 @@
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
 *              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Enable SysTick Timer with the System clock given by Mcu_GetCoreFrequency
 *              - Enable SysTick Timer Interrupt and set its priority
+*              A Tick_Time of 0 or above the 24-bit reload (209 ms at 80 MHz) is reported
+*              with GPT_E_PARAM_VALUE and the SysTick Timer is not started.
 ************************************************************************************/	
 void SysTick_Start(uint16 Tick_Time);
 
@@ -57,4 +477,11 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Gpt and other modules */
+extern const Gpt_ConfigType Gpt_Configuration;
+
 #endif /* GPT_H */
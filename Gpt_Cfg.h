@@ -0,0 +1,74 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_CFG_SW_MAJOR_VERSION              (1U)
+#define GPT_CFG_SW_MINOR_VERSION              (0U)
+#define GPT_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define GPT_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_DeInit API */
+#define GPT_DEINIT_API                      (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeElapsed API */
+#define GPT_TIME_ELAPSED_API                (STD_ON)
+
+/* Pre-compile option for presence of Gpt_GetTimeRemaining API */
+#define GPT_TIME_REMAINING_API              (STD_ON)
+
+/* Pre-compile option for presence of Gpt_EnableNotification and Gpt_DisableNotification APIs */
+#define GPT_ENABLE_DISABLE_NOTIFICATION_API (STD_ON)
+
+/* Pre-compile option for presence of Gpt_SetMode , Gpt_EnableWakeup , Gpt_DisableWakeup and Gpt_CheckWakeup APIs */
+#define GPT_WAKEUP_FUNCTIONALITY_API        (STD_ON)
+
+/*
+ * Pre-compile option for presence of the timestamp APIs (Not exist in AUTOSAR 4.0.3 GPT SWS Document):
+ * GPT_TIMESTAMP_TIMER counts up at the core clock from Gpt_Init , its overflows extend it to 64 bits.
+ * This hardware timer cannot be used by a channel.
+ */
+#define GPT_TIMESTAMP_API                   (STD_ON)
+#define GPT_TIMESTAMP_TIMER                 (GPT_WIDE_TIMER_5)
+
+/* Number of the configured Gpt Channels */
+#define GPT_CONFIGURED_CHANNELS             (2U)
+
+/* Channel Index in the array of structures in Gpt_PBcfg.c */
+#define GptConf_TIMEOUT_CHANNEL_ID_INDEX    (Gpt_ChannelType)0x00
+#define GptConf_PERIODIC_CHANNEL_ID_INDEX   (Gpt_ChannelType)0x01
+
+/*
+ * Configured channels , expanded by Gpt_PBcfg.c into Gpt_Configuration and by its compile time checks:
+ * CHANNEL( Name , Hardware timer , Channel mode , Prescaler , Tick value max , Notification , Wakeup source )
+ * Name selects GptConf_<Name>_CHANNEL_ID_INDEX , every hardware timer is used by one channel at most.
+ * The channel counts every (Prescaler + 1) core clocks : up to 0xFF and 0xFFFF ticks on Timer0-5 ,
+ * up to 0xFFFF and 0xFFFFFFFF ticks on WideTimer0-5 (79 gives 1 us ticks at 80 MHz).
+ * Notification is a void (void) function or NULL_PTR , Wakeup source is 0 for a channel that cannot wake up.
+ */
+#define GptConf_CHANNELS(CHANNEL) \
+    CHANNEL( TIMEOUT  , GPT_TIMER_0      , GPT_CH_MODE_ONESHOT    , 79U , 0xFFFFU     , NULL_PTR , 0x00U ) \
+    CHANNEL( PERIODIC , GPT_WIDE_TIMER_0 , GPT_CH_MODE_CONTINUOUS , 79U , 0xFFFFFFFFU , NULL_PTR , 0x01U )
+
+#endif /* GPT_CFG_H */
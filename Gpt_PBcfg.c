@@ -0,0 +1,80 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Gpt Driver
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#include "Gpt.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define GPT_PBCFG_SW_MAJOR_VERSION              (1U)
+#define GPT_PBCFG_SW_MINOR_VERSION              (0U)
+#define GPT_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define GPT_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define GPT_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define GPT_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_AR_RELEASE_MAJOR_VERSION != GPT_AR_RELEASE_MAJOR_VERSION)\
+ ||  (GPT_PBCFG_AR_RELEASE_MINOR_VERSION != GPT_AR_RELEASE_MINOR_VERSION)\
+ ||  (GPT_PBCFG_AR_RELEASE_PATCH_VERSION != GPT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Gpt_PBcfg.c and Gpt.h files */
+#if ((GPT_PBCFG_SW_MAJOR_VERSION != GPT_SW_MAJOR_VERSION)\
+ ||  (GPT_PBCFG_SW_MINOR_VERSION != GPT_SW_MINOR_VERSION)\
+ ||  (GPT_PBCFG_SW_PATCH_VERSION != GPT_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* Channel rows , placed at their index */
+#define GPT_CHANNEL_INIT(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    [GptConf_##NAME##_CHANNEL_ID_INDEX] = { TIMER , MODE , PRESCALER , TICK_MAX , NOTIFICATION , WAKEUP },
+
+/* Compile time checks of the Gpt configuration:
+ *  1. the hardware timer exists , the prescaler and the tick value max fit in it.
+ *  2. every hardware timer and every channel index is used once.
+ *  3. all the GPT_CONFIGURED_CHANNELS channels are configured.
+ *  4. the timestamp timer is not used by a channel.
+ */
+#define GPT_CHANNEL_IS_VALID(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    && ((TIMER) < GPT_TIMERS_NUM) \
+    && ((PRESCALER) <= GPT_PRESCALER_MAX(TIMER)) \
+    && ((TICK_MAX) != 0U) && ((uint64)(TICK_MAX) <= GPT_COUNTER_MAX(TIMER)) \
+    && (((MODE) == GPT_CH_MODE_CONTINUOUS) || ((MODE) == GPT_CH_MODE_ONESHOT))
+#define GPT_CHANNEL_TIMER_SUM(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    + ((uint32)1 << ((TIMER) & 31U))
+#define GPT_CHANNEL_TIMER_OR(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    | ((uint32)1 << ((TIMER) & 31U))
+#define GPT_CHANNEL_INDEX_SUM(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    + ((uint64)1 << (GptConf_##NAME##_CHANNEL_ID_INDEX & 63U))
+#define GPT_CHANNEL_INDEX_OR(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    | ((uint64)1 << (GptConf_##NAME##_CHANNEL_ID_INDEX & 63U))
+#define GPT_CHANNEL_COUNT(NAME,TIMER,MODE,PRESCALER,TICK_MAX,NOTIFICATION,WAKEUP) \
+    + 1U
+
+STATIC_ASSERT((1 GptConf_CHANNELS(GPT_CHANNEL_IS_VALID)) , Gpt_Channel_Invalid) ;
+STATIC_ASSERT(((uint32)0 GptConf_CHANNELS(GPT_CHANNEL_TIMER_SUM)) == ((uint32)0 GptConf_CHANNELS(GPT_CHANNEL_TIMER_OR)) , Gpt_Timer_Used_Twice) ;
+STATIC_ASSERT(((uint64)0 GptConf_CHANNELS(GPT_CHANNEL_INDEX_SUM)) == ((uint64)0 GptConf_CHANNELS(GPT_CHANNEL_INDEX_OR)) , Gpt_Duplicate_Channel_Index) ;
+STATIC_ASSERT((0U GptConf_CHANNELS(GPT_CHANNEL_COUNT)) == GPT_CONFIGURED_CHANNELS , Gpt_Channels_Count) ;
+#if (GPT_TIMESTAMP_API == STD_ON)
+STATIC_ASSERT((((uint32)0 GptConf_CHANNELS(GPT_CHANNEL_TIMER_OR)) & ((uint32)1 << GPT_TIMESTAMP_TIMER)) == 0U , Gpt_Timestamp_Timer_Used_By_Channel) ;
+STATIC_ASSERT(GPT_IS_WIDE_TIMER(GPT_TIMESTAMP_TIMER) && (GPT_TIMESTAMP_TIMER < GPT_TIMERS_NUM) , Gpt_Timestamp_Timer_Not_Wide) ;
+#endif
+
+/* PB structure used with Gpt_Init API */
+const Gpt_ConfigType Gpt_Configuration = {
+                                             { GptConf_CHANNELS(GPT_CHANNEL_INIT) }
+				                         };
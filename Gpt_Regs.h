@@ -0,0 +1,62 @@
+ /******************************************************************************
+ *
+ * Module: Gpt
+ *
+ * File Name: Gpt_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Gpt Driver Registers
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef GPT_REGS_H
+#define GPT_REGS_H
+
+#include "Std_Types.h"
+
+/* 16/32-bit timers base addresses */
+#define GPT_TIMER0_BASE_ADDRESS        0x40030000
+#define GPT_TIMER1_BASE_ADDRESS        0x40031000
+#define GPT_TIMER2_BASE_ADDRESS        0x40032000
+#define GPT_TIMER3_BASE_ADDRESS        0x40033000
+#define GPT_TIMER4_BASE_ADDRESS        0x40034000
+#define GPT_TIMER5_BASE_ADDRESS        0x40035000
+
+/* 32/64-bit wide timers base addresses */
+#define GPT_WIDE_TIMER0_BASE_ADDRESS   0x40036000
+#define GPT_WIDE_TIMER1_BASE_ADDRESS   0x40037000
+#define GPT_WIDE_TIMER2_BASE_ADDRESS   0x4004C000
+#define GPT_WIDE_TIMER3_BASE_ADDRESS   0x4004D000
+#define GPT_WIDE_TIMER4_BASE_ADDRESS   0x4004E000
+#define GPT_WIDE_TIMER5_BASE_ADDRESS   0x4004F000
+
+/* Timer registers offsets */
+#define GPT_CFG_REG_OFFSET             0x000
+#define GPT_TAMR_REG_OFFSET            0x004
+#define GPT_CTL_REG_OFFSET             0x00C
+#define GPT_IMR_REG_OFFSET             0x018
+#define GPT_RIS_REG_OFFSET             0x01C
+#define GPT_MIS_REG_OFFSET             0x020
+#define GPT_ICR_REG_OFFSET             0x024
+#define GPT_TAILR_REG_OFFSET           0x028
+#define GPT_TAPR_REG_OFFSET            0x038
+#define GPT_TAV_REG_OFFSET             0x050
+
+/* GPTMCFG : timer A and timer B split , 16-bit timers or 32-bit wide timers */
+#define GPT_CFG_SPLIT                  0x04
+
+/* GPTMTAMR fields : one-shot or periodic mode , counting down */
+#define GPT_TAMR_ONESHOT               0x01
+#define GPT_TAMR_PERIODIC              0x02
+
+/* GPTMTAMR field : timer A counts up from 0 to GPTMTAILR */
+#define GPT_TAMR_TACDIR_UP             0x10
+
+/* GPTMCTL fields : timer A enable and stall while the debugger halts the core */
+#define GPT_CTL_TAEN                   0x01
+#define GPT_CTL_TASTALL                0x02
+
+/* GPTMIMR , GPTMRIS , GPTMMIS and GPTMICR field : timer A time-out */
+#define GPT_INT_TATO                   0x01
+
+#endif /* GPT_REGS_H */
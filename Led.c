@@ -15,26 +15,26 @@
 /*********************************************************************************************/
 void Led_SetOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    Dio_WriteChannelConst(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
 }
 
 /*********************************************************************************************/
 void Led_SetOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    Dio_WriteChannelConst(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
 }
 
 /*********************************************************************************************/
 void Led_RefreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+    Dio_LevelType state = Dio_ReadOutputChannelConst(DioConf_LED1_CHANNEL_ID_INDEX); /* last written value from RAM */
+    Dio_WriteChannelConst(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
 }
 
 /*********************************************************************************************/
 void Led_Toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    Dio_LevelType state = Dio_FlipChannelConst(DioConf_LED1_CHANNEL_ID_INDEX);
 }
 
 /*********************************************************************************************/
@@ -0,0 +1,301 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Mcu Driver (system clock tree).
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#include "Mcu.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Mcu Modules */
+#if ((DET_AR_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* RCC register fields */
+#define MCU_RCC_MOSCDIS                (0x00000001U)
+#define MCU_RCC_XTAL_SHIFT             (6U)
+#define MCU_RCC_XTAL_MASK              (0x000007C0U)
+#define MCU_RCC_BYPASS                 (0x00000800U)
+#define MCU_RCC_USESYSDIV              (0x00400000U)
+
+/* RCC2 register fields */
+#define MCU_RCC2_OSCSRC2_MASK          (0x00000070U)
+#define MCU_RCC2_OSCSRC2_MOSC          (0x00000000U)
+#define MCU_RCC2_OSCSRC2_PIOSC         (0x00000010U)
+#define MCU_RCC2_BYPASS2               (0x00000800U)
+#define MCU_RCC2_PWRDN2                (0x00002000U)
+#define MCU_RCC2_SYSDIV2LSB            (0x00400000U)
+#define MCU_RCC2_SYSDIV2_SHIFT         (23U)
+#define MCU_RCC2_SYSDIV2_MASK          (0x1F800000U)
+#define MCU_RCC2_DIV400                (0x40000000U)
+#define MCU_RCC2_USERCC2               (0x80000000U)
+
+/* RIS register fields */
+#define MCU_RIS_PLLLRIS                (0x00000040U)
+#define MCU_RIS_MOSCPUPRIS             (0x00000100U)
+
+/* PLLSTAT register fields */
+#define MCU_PLLSTAT_LOCK               (0x00000001U)
+
+/* Crystal values of the RCC XTAL field covered by the table , the PLL needs 5 MHz at least */
+#define MCU_CRYSTAL_FIRST              (0x06U)
+#define MCU_CRYSTAL_LAST               (0x1AU)
+#define MCU_CRYSTAL_PLL_FIRST          (0x09U)
+
+/* Divisor ranges : 7 bits {SYSDIV2 , SYSDIV2LSB} behind the PLL , 6 bits SYSDIV2 otherwise */
+#define MCU_PLL_SYSDIV_MIN             (5U)
+#define MCU_PLL_SYSDIV_MAX             (128U)
+#define MCU_OSC_SYSDIV_MAX             (64U)
+
+/* Crystal frequencies in Hz indexed by (XTAL - MCU_CRYSTAL_FIRST) */
+STATIC const uint32 Mcu_CrystalFrequency[MCU_CRYSTAL_LAST - MCU_CRYSTAL_FIRST + 1U] =
+{
+	 4000000U,  4096000U,  4915200U,  5000000U,  5120000U,  6000000U,  6144000U,
+	 7372800U,  8000000U,  8192000U, 10000000U, 12000000U, 12288000U, 13560000U,
+	14318180U, 16000000U, 16384000U, 18000000U, 20000000U, 24000000U, 25000000U
+};
+
+/* Clock tree selected in Mcu_Cfg.h */
+STATIC const Mcu_ClockSettingType Mcu_ClockSetting =
+{
+	MCU_CRYSTAL_VALUE, MCU_USE_PLL, MCU_SYSTEM_CLOCK_DIVISOR
+};
+
+/* The core runs from the PIOSC out of reset and whenever the clock bring up fails */
+STATIC uint32 Mcu_CoreFrequency = MCU_PIOSC_FREQUENCY;
+STATIC boolean Mcu_PllUsed = FALSE;
+STATIC boolean Mcu_Initialized = FALSE;
+
+/************************************************************************************
+* Service Name: Mcu_WaitRawStatus
+* Parameters (in): Mask - RIS bit to wait for
+* Return value: boolean - TRUE when the bit is set before MCU_CLOCK_READY_TIMEOUT polls
+* Description: Polls the system control raw interrupt status for a clock ready event.
+************************************************************************************/
+STATIC boolean Mcu_WaitRawStatus(uint32 Mask)
+{
+	uint32 Polls;
+
+	for(Polls = 0; Polls < MCU_CLOCK_READY_TIMEOUT; Polls++)
+	{
+		if(0U != (SYSCTL_RIS_REG & Mask))
+		{
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/************************************************************************************
+* Service Name: Mcu_CalculateClock
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Setting - Crystal , clock source and divisor.
+* Parameters (inout): None
+* Parameters (out): Tree - Resulting frequency and RCC/RCC2 field values.
+* Return value: Std_ReturnType - E_OK for a valid clock tree.
+* Description: Validates a clock tree choice and computes its register values.
+*              No register is accessed , the function only does arithmetic.
+************************************************************************************/
+Std_ReturnType Mcu_CalculateClock(const Mcu_ClockSettingType * Setting, Mcu_ClockTreeType * Tree)
+{
+	uint32 Source;
+	uint32 Field;
+
+	if((NULL_PTR == Setting) || (NULL_PTR == Tree))
+	{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_CALCULATE_CLOCK_SID,
+		     MCU_E_PARAM_POINTER);
+#endif
+		return E_NOT_OK;
+	}
+
+	if((Setting->Crystal < MCU_CRYSTAL_FIRST) || (Setting->Crystal > MCU_CRYSTAL_LAST)
+	|| ((STD_ON == Setting->UsePll) && (Setting->Crystal < MCU_CRYSTAL_PLL_FIRST)))
+	{
+		return E_NOT_OK;
+	}
+
+	if(STD_ON == Setting->UsePll)
+	{
+		/* DIV400 set : 400 MHz / ({SYSDIV2 , SYSDIV2LSB} + 1) */
+		if((Setting->SysDiv < MCU_PLL_SYSDIV_MIN) || (Setting->SysDiv > MCU_PLL_SYSDIV_MAX))
+		{
+			return E_NOT_OK;
+		}
+		Source = MCU_PLL_FREQUENCY;
+		Field  = (uint32)Setting->SysDiv - 1U;
+		Tree->Rcc2 = MCU_RCC2_USERCC2 | MCU_RCC2_DIV400 | MCU_RCC2_OSCSRC2_MOSC
+		           | ((Field >> 1) << MCU_RCC2_SYSDIV2_SHIFT)
+		           | ((0U != (Field & 1U)) ? MCU_RCC2_SYSDIV2LSB : 0U);
+	}
+	else
+	{
+		/* Bypass : main oscillator / (SYSDIV2 + 1) */
+		if((0U == Setting->SysDiv) || (Setting->SysDiv > MCU_OSC_SYSDIV_MAX))
+		{
+			return E_NOT_OK;
+		}
+		Source = Mcu_CrystalFrequency[Setting->Crystal - MCU_CRYSTAL_FIRST];
+		Field  = (uint32)Setting->SysDiv - 1U;
+		Tree->Rcc2 = MCU_RCC2_USERCC2 | MCU_RCC2_OSCSRC2_MOSC | (Field << MCU_RCC2_SYSDIV2_SHIFT);
+	}
+
+	Tree->Frequency = Source / Setting->SysDiv;
+	if(Tree->Frequency > MCU_MAX_CORE_FREQUENCY)
+	{
+		return E_NOT_OK;
+	}
+	/* The divisor is only used when USESYSDIV is set , a divisor of 1 leaves it cleared */
+	Tree->Rcc = ((uint32)Setting->Crystal << MCU_RCC_XTAL_SHIFT)
+	          | ((Setting->SysDiv > 1U) ? MCU_RCC_USESYSDIV : 0U);
+	return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK when the configured clock runs the core.
+* Description: Function to switch the system clock to the main oscillator and the PLL
+*              following the data sheet sequence. The core keeps running from the
+*              bypassed PIOSC until the new clock is stable , so a missing crystal or
+*              a PLL failing to lock leaves it at 16 MHz.
+*              Note : the TM4C123 flash has no wait state setting , above 40 MHz the flash
+*              controller inserts the wait states itself behind its prefetch buffer.
+************************************************************************************/
+Std_ReturnType Mcu_Init(void)
+{
+	Mcu_ClockTreeType Tree;
+	uint32 Rcc;
+	uint32 Rcc2;
+
+	Mcu_Initialized = TRUE;
+
+	if(E_OK != Mcu_CalculateClock(&Mcu_ClockSetting, &Tree))
+	{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID,
+		     MCU_E_PARAM_CLOCK);
+#endif
+		return E_NOT_OK;
+	}
+
+	/* 1. Use RCC2 and bypass the PLL and the divider while the clock tree is changed */
+	Rcc2 = SYSCTL_RCC2_REG | MCU_RCC2_USERCC2 | MCU_RCC2_BYPASS2;
+	SYSCTL_RCC2_REG = Rcc2;
+	Rcc = (SYSCTL_RCC_REG | MCU_RCC_BYPASS) & ~MCU_RCC_USESYSDIV;
+	SYSCTL_RCC_REG = Rcc;
+
+	/* 2. Power up the main oscillator with the configured crystal and wait for it to be stable */
+	SYSCTL_MISC_REG = MCU_RIS_MOSCPUPRIS | MCU_RIS_PLLLRIS;   /* clear the old ready events */
+	Rcc = (Rcc & ~(MCU_RCC_MOSCDIS | MCU_RCC_XTAL_MASK)) | (Tree.Rcc & MCU_RCC_XTAL_MASK);
+	SYSCTL_RCC_REG = Rcc;
+	if(FALSE == Mcu_WaitRawStatus(MCU_RIS_MOSCPUPRIS))
+	{
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID,
+		     MCU_E_PLL_NOT_LOCKED);
+#endif
+		return E_NOT_OK;
+	}
+	Rcc2 = (Rcc2 & ~MCU_RCC2_OSCSRC2_MASK) | MCU_RCC2_OSCSRC2_MOSC;
+
+	if(STD_ON == Mcu_ClockSetting.UsePll)
+	{
+		/* 3. Power up the PLL , its multiplier is loaded by the hardware from the XTAL field */
+		Rcc2 &= ~MCU_RCC2_PWRDN2;
+		SYSCTL_RCC2_REG = Rcc2;
+	}
+	else
+	{
+		SYSCTL_RCC2_REG = Rcc2 | MCU_RCC2_PWRDN2;
+	}
+
+	/* 4. Program the system clock divisor and enable it */
+	Rcc2 = (Rcc2 & ~(MCU_RCC2_DIV400 | MCU_RCC2_SYSDIV2_MASK | MCU_RCC2_SYSDIV2LSB)) | Tree.Rcc2;
+	SYSCTL_RCC2_REG = Rcc2;
+	SYSCTL_RCC_REG = Rcc | (Tree.Rcc & MCU_RCC_USESYSDIV);
+
+	if(STD_ON == Mcu_ClockSetting.UsePll)
+	{
+		/* 5. Wait for the PLL to lock , the core stays on the PIOSC if it never does */
+		if(FALSE == Mcu_WaitRawStatus(MCU_RIS_PLLLRIS))
+		{
+			SYSCTL_RCC_REG = Rcc;
+			SYSCTL_RCC2_REG = (Rcc2 & ~MCU_RCC2_OSCSRC2_MASK) | MCU_RCC2_OSCSRC2_PIOSC | MCU_RCC2_PWRDN2;
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+			Det_ReportError(MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_INIT_SID,
+			     MCU_E_PLL_NOT_LOCKED);
+#endif
+			return E_NOT_OK;
+		}
+		/* 6. Run the core from the PLL */
+		SYSCTL_RCC2_REG = Rcc2 & ~MCU_RCC2_BYPASS2;
+		Mcu_PllUsed = TRUE;
+	}
+	else
+	{
+		/* 6. Run the core from the main oscillator through the divider */
+		SYSCTL_RCC2_REG = Rcc2;
+	}
+
+	Mcu_CoreFrequency = Tree.Frequency;
+	return E_OK;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - lock status of the PLL.
+* Description: Returns the lock status of the PLL , undefined before Mcu_Init or when the
+*              PLL is not used.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void)
+{
+	if((FALSE == Mcu_Initialized) || (FALSE == Mcu_PllUsed))
+	{
+		return MCU_PLL_STATUS_UNDEFINED;
+	}
+	return (0U != (SYSCTL_PLLSTAT_REG & MCU_PLLSTAT_LOCK)) ? MCU_PLL_LOCKED : MCU_PLL_UNLOCKED;
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetCoreFrequency
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Core frequency in Hz.
+* Description: Returns the frequency of the system clock , 16 MHz until Mcu_Init switches it.
+************************************************************************************/
+uint32 Mcu_GetCoreFrequency(void)
+{
+	return Mcu_CoreFrequency;
+}
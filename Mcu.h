@@ -0,0 +1,197 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Mcu Driver (system clock tree).
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef MCU_H
+#define MCU_H
+
+/* Id for the company in the AUTOSAR */
+#define MCU_VENDOR_ID    (1000U)
+
+/* Mcu Module Id */
+#define MCU_MODULE_ID    (101U)
+
+/* Mcu Instance Id */
+#define MCU_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_SW_MAJOR_VERSION           (1U)
+#define MCU_SW_MINOR_VERSION           (0U)
+#define MCU_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_AR_RELEASE_MAJOR_VERSION   (4U)
+#define MCU_AR_RELEASE_MINOR_VERSION   (0U)
+#define MCU_AR_RELEASE_PATCH_VERSION   (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Mcu Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+/* AUTOSAR Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_AR_RELEASE_MAJOR_VERSION != MCU_AR_RELEASE_MAJOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_MINOR_VERSION != MCU_AR_RELEASE_MINOR_VERSION)\
+ ||  (MCU_CFG_AR_RELEASE_PATCH_VERSION != MCU_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Mcu_Cfg.h and Mcu.h files */
+#if ((MCU_CFG_SW_MAJOR_VERSION != MCU_SW_MAJOR_VERSION)\
+ ||  (MCU_CFG_SW_MINOR_VERSION != MCU_SW_MINOR_VERSION)\
+ ||  (MCU_CFG_SW_PATCH_VERSION != MCU_SW_PATCH_VERSION))
+  #error "The SW version of Mcu_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Mcu Init */
+#define MCU_INIT_SID                   (uint8)0x00
+
+/* Service ID for Mcu GetPllStatus */
+#define MCU_GET_PLL_STATUS_SID         (uint8)0x04
+
+/* Service ID for Mcu GetCoreFrequency */
+#define MCU_GET_CORE_FREQUENCY_SID     (uint8)0x10
+
+/* Service ID for Mcu CalculateClock */
+#define MCU_CALCULATE_CLOCK_SID        (uint8)0x11
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Invalid clock setting (crystal or divisor) */
+#define MCU_E_PARAM_CLOCK              (uint8)0x0B
+
+/* The main oscillator did not power up or the PLL did not lock in time */
+#define MCU_E_PLL_NOT_LOCKED           (uint8)0x0E
+
+/* API service called with a NULL pointer */
+#define MCU_E_PARAM_POINTER            (uint8)0x10
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Frequency of the precision internal oscillator running the core out of reset */
+#define MCU_PIOSC_FREQUENCY            (16000000U)
+
+/* PLL output frequency , the DIV400 divider takes it directly */
+#define MCU_PLL_FREQUENCY              (400000000U)
+
+/* Maximum system clock of the TM4C123GH6PM */
+#define MCU_MAX_CORE_FREQUENCY         (80000000U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Status of the PLL returned by Mcu_GetPllStatus */
+typedef enum
+{
+	MCU_PLL_LOCKED, MCU_PLL_UNLOCKED, MCU_PLL_STATUS_UNDEFINED
+} Mcu_PllStatusType;
+
+/* Clock tree choice , the input of Mcu_CalculateClock */
+typedef struct
+{
+	/* Crystal of the main oscillator , RCC XTAL field value (0x06 : 4 MHz .. 0x1A : 25 MHz) */
+	uint8 Crystal;
+	/* STD_ON to run from the 400 MHz PLL output , STD_OFF from the main oscillator */
+	boolean UsePll;
+	/* System clock divisor : 5 .. 128 from the PLL , 1 .. 64 from the main oscillator */
+	uint8 SysDiv;
+} Mcu_ClockSettingType;
+
+/* Clock tree computed by Mcu_CalculateClock and programmed by Mcu_Init */
+typedef struct
+{
+	/* Resulting core frequency in Hz */
+	uint32 Frequency;
+	/* RCC fields : XTAL and USESYSDIV */
+	uint32 Rcc;
+	/* RCC2 fields : USERCC2 , DIV400 , SYSDIV2 , SYSDIV2LSB and OSCSRC2 (main oscillator) */
+	uint32 Rcc2;
+} Mcu_ClockTreeType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK when the configured clock runs the core ,
+*                                E_NOT_OK when the core stays on the 16 MHz PIOSC.
+* Description: Brings up the main oscillator and the PLL selected in Mcu_Cfg.h and switches the
+*              system clock to them. Shall be called first , before any timer is started.
+************************************************************************************/
+Std_ReturnType Mcu_Init(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetPllStatus
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Mcu_PllStatusType - lock status of the PLL , undefined before Mcu_Init.
+* Description: Returns the lock status of the PLL.
+************************************************************************************/
+Mcu_PllStatusType Mcu_GetPllStatus(void);
+
+/************************************************************************************
+* Service Name: Mcu_GetCoreFrequency
+* Service ID[hex]: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Core (system clock) frequency in Hz.
+* Description: Returns the frequency of the clock running the core and the timers.
+************************************************************************************/
+uint32 Mcu_GetCoreFrequency(void);
+
+/************************************************************************************
+* Service Name: Mcu_CalculateClock
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Setting - Crystal , clock source and divisor.
+* Parameters (inout): None
+* Parameters (out): Tree - Resulting frequency and RCC/RCC2 field values.
+* Return value: Std_ReturnType - E_NOT_OK for an unknown crystal , a crystal out of the PLL input range
+*                                (5 .. 25 MHz) , a divisor out of range or a frequency above 80 MHz.
+* Description: Validates a clock tree choice and computes its register values without touching
+*              the hardware , so it can also be tested on the host.
+************************************************************************************/
+Std_ReturnType Mcu_CalculateClock(const Mcu_ClockSettingType * Setting, Mcu_ClockTreeType * Tree);
+
+#endif /* MCU_H */
@@ -0,0 +1,46 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H
+#define MCU_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define MCU_CFG_SW_MAJOR_VERSION              (1U)
+#define MCU_CFG_SW_MINOR_VERSION              (0U)
+#define MCU_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define MCU_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define MCU_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define MCU_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define MCU_DEV_ERROR_DETECT                (STD_ON)
+
+/* Crystal of the main oscillator , RCC XTAL field value (0x15 : 16 MHz crystal of the LaunchPad) */
+#define MCU_CRYSTAL_VALUE                   (0x15U)
+
+/*
+ * Source of the system clock:
+ * STD_ON  - the 400 MHz PLL output divided by MCU_SYSTEM_CLOCK_DIVISOR (5 .. 128 , 5 gives the maximum 80 MHz).
+ * STD_OFF - the main oscillator divided by MCU_SYSTEM_CLOCK_DIVISOR (1 .. 64).
+ */
+#define MCU_USE_PLL                         (STD_ON)
+#define MCU_SYSTEM_CLOCK_DIVISOR            (5U)
+
+/* Number of status polls before the main oscillator power up or the PLL lock is considered failed */
+#define MCU_CLOCK_READY_TIMEOUT             (0x10000U)
+
+#endif /* MCU_CFG_H */
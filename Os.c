@@ -14,6 +14,8 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Dio.h"
+#include "Common_Macros.h"
 
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
@@ -27,15 +29,110 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Wait For Interrupt ... This Macro puts the core in sleep mode until an interrupt is pending , even a masked one */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+
+#if ((OS_CPU_LOAD_API == STD_ON) && (GPT_TIMESTAMP_API != STD_ON))
+  #error "The Os CPU load meter needs the Gpt timestamp (GPT_TIMESTAMP_API)"
+#endif
+
+/* Task table rows */
+#define OS_TASK_INIT(FUNCTION, PERIOD, OFFSET, PRIORITY) \
+    { FUNCTION , (PERIOD) / OS_BASE_TIME , (OFFSET) / OS_BASE_TIME , PRIORITY },
+
+/* Compile time checks of the task table:
+ *  1. the period and the offset are multiples of OS_BASE_TIME , the offset is below the period.
+ *  2. the priorities are below OS_PRIORITIES_NUM and unique.
+ *  3. every period divides OS_HYPERPERIOD , and the hyperperiod fits in OS_MAX_HYPERPERIOD_TICKS.
+ */
+#define OS_TASK_IS_VALID(FUNCTION, PERIOD, OFFSET, PRIORITY) \
+    && ((PERIOD) >= OS_BASE_TIME) && (((PERIOD) % OS_BASE_TIME) == 0U) \
+    && (((OFFSET) % OS_BASE_TIME) == 0U) && ((OFFSET) < (PERIOD)) \
+    && ((PRIORITY) < OS_PRIORITIES_NUM) \
+    && ((OS_HYPERPERIOD % (PERIOD)) == 0U)
+#define OS_TASK_PRIORITY_SUM(FUNCTION, PERIOD, OFFSET, PRIORITY) \
+    + ((uint64)1 << ((PRIORITY) & 31U))
+#define OS_TASK_PRIORITY_OR(FUNCTION, PERIOD, OFFSET, PRIORITY) \
+    | ((uint64)1 << ((PRIORITY) & 31U))
+#define OS_TASK_COUNT(FUNCTION, PERIOD, OFFSET, PRIORITY) \
+    + 1U
+
+STATIC_ASSERT((1 OsConf_TASKS(OS_TASK_IS_VALID)) , Os_Task_Invalid) ;
+STATIC_ASSERT(((uint64)0 OsConf_TASKS(OS_TASK_PRIORITY_SUM)) == ((uint64)0 OsConf_TASKS(OS_TASK_PRIORITY_OR)) , Os_Duplicate_Task_Priority) ;
+STATIC_ASSERT((OS_HYPERPERIOD / OS_BASE_TIME) <= OS_MAX_HYPERPERIOD_TICKS , Os_Hyperperiod_Too_Long) ;
+
+/* Number of Os ticks in the hyperperiod */
+#define OS_HYPERPERIOD_TICKS    (OS_HYPERPERIOD / OS_BASE_TIME)
+
+/* Number of the configured tasks */
+#define OS_TASKS_NUM    (0U OsConf_TASKS(OS_TASK_COUNT))
+
+/* Task table */
+static const Os_TaskType Os_Tasks[OS_TASKS_NUM] = { OsConf_TASKS(OS_TASK_INIT) };
+
+/* Task of every priority , filled by Os_start */
+static void (*Os_PriorityTask[OS_PRIORITIES_NUM])(void);
+
+/* Bitmap of the tasks ready in every tick of the hyperperiod , bit n is the task of priority n */
+static uint32 Os_ReadyTable[OS_HYPERPERIOD_TICKS];
+
+/* Index in Os_ReadyTable of the next tick */
+static uint32 Os_TickIndex = 0;
+
+/* Global variable store the Os Time in the hyperperiod */
+static uint32 g_Time_Tick_Count = 0;
 
 /* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+static volatile uint8 g_New_Time_Tick_Flag = 0;
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/* Timestamp of the start of the current hyperperiod and idle cycles counted since */
+static uint32 Os_HyperperiodStart = 0;
+static uint32 Os_IdleCycles = 0;
+static boolean Os_CpuLoadStarted = FALSE;
+
+/* Busy and total cycles of all the complete hyperperiods , for the average load */
+static uint64 Os_BusyCyclesSum = 0;
+static uint64 Os_TotalCyclesSum = 0;
+
+/* Load values returned by Os_GetCpuLoad */
+static Os_CpuLoadType Os_CpuLoad = { 0 , 0 , 0 };
+#endif
+
+/*********************************************************************************************/
+/* Description: Compute the ready tasks bitmap of each tick of the hyperperiod ,
+ * tick index i is the time (i + 1) * OS_BASE_TIME as the first tick comes one base time after the start.
+ * Every period divides the hyperperiod (checked at compile time) , so no task loses its phase at the wrap */
+static void Os_BuildReadyTable(void)
+{
+    uint32 Task;
+    uint32 Tick;
+
+    for(Task = 0; Task < OS_TASKS_NUM; Task++)
+    {
+        Os_PriorityTask[Os_Tasks[Task].Priority] = Os_Tasks[Task].Function;
+    }
+
+    for(Tick = 0; Tick < OS_HYPERPERIOD_TICKS; Tick++)
+    {
+        Os_ReadyTable[Tick] = 0;
+        for(Task = 0; Task < OS_TASKS_NUM; Task++)
+        {
+            if(((Tick + 1) % Os_Tasks[Task].Period) == Os_Tasks[Task].Offset)
+            {
+                Os_ReadyTable[Tick] |= ((uint32)1 << Os_Tasks[Task].Priority);
+            }
+        }
+    }
+    Os_TickIndex = 0;
+}
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+    /* Build the ready tasks of every tick before the first tick comes */
+    Os_BuildReadyTable();
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
     
@@ -58,13 +155,87 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
 
     /* Set the flag to 1 to indicate that there is a new timer tick */
     g_New_Time_Tick_Flag = 1;
 }
 
+/*********************************************************************************************/
+/* Description: Idle path between the ticks.
+ * With OS_IDLE_SLEEP the interrupts are masked while the flag is checked , so a tick coming between the check
+ * and WFI leaves its interrupt pending and WFI returns at once. The tick ISR runs when the interrupts are
+ * enabled again , after the idle cycles are counted.
+ * Without it the flag is polled with the interrupts enabled until the tick ISR sets it , the whole wait is
+ * counted as idle so the load meter gives the same values in both modes. */
+static void Os_Idle(void)
+{
+#if (OS_CPU_LOAD_API == STD_ON)
+    uint32 Idle_Start;
+#endif
+
+#if (OS_IDLE_SLEEP == STD_ON)
+    Disable_Exceptions();
+    if(g_New_Time_Tick_Flag == 0)
+    {
+#if (OS_CPU_LOAD_API == STD_ON)
+        Idle_Start = Gpt_GetTimestampLow();
+#endif
+        Wait_For_Interrupt();
+#if (OS_CPU_LOAD_API == STD_ON)
+        Os_IdleCycles += Gpt_GetTimestampLow() - Idle_Start;
+#endif
+    }
+    Enable_Exceptions();
+#else
+#if (OS_CPU_LOAD_API == STD_ON)
+    Idle_Start = Gpt_GetTimestampLow();
+#endif
+    while(g_New_Time_Tick_Flag == 0)
+    {
+        /* Wait for the next tick */
+    }
+#if (OS_CPU_LOAD_API == STD_ON)
+    Os_IdleCycles += Gpt_GetTimestampLow() - Idle_Start;
+#endif
+#endif
+}
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/*********************************************************************************************/
+/* Description: Close the measurement of a hyperperiod at its first tick and update the load values */
+static void Os_UpdateCpuLoad(void)
+{
+    uint32 Now   = Gpt_GetTimestampLow();
+    uint32 Total = Now - Os_HyperperiodStart;
+    uint32 Busy  = Total - Os_IdleCycles;
+
+    /* The first call only starts the measurement */
+    if((Os_CpuLoadStarted == TRUE) && (Total != 0))
+    {
+        Os_CpuLoad.Current = (uint16)(((uint64)Busy * OS_CPU_LOAD_FULL_SCALE) / Total);
+        if(Os_CpuLoad.Current > Os_CpuLoad.Peak)
+        {
+            Os_CpuLoad.Peak = Os_CpuLoad.Current;
+        }
+        Os_BusyCyclesSum  += Busy;
+        Os_TotalCyclesSum += Total;
+        Os_CpuLoad.Average = (uint16)((Os_BusyCyclesSum * OS_CPU_LOAD_FULL_SCALE) / Os_TotalCyclesSum);
+    }
+    Os_CpuLoadStarted   = TRUE;
+    Os_HyperperiodStart = Now;
+    Os_IdleCycles = 0;
+}
+
+/*********************************************************************************************/
+void Os_GetCpuLoad(Os_CpuLoadType * LoadPtr)
+{
+    if(LoadPtr != NULL_PTR)
+    {
+        *LoadPtr = Os_CpuLoad;
+    }
+}
+#endif
+
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
@@ -73,32 +244,38 @@ void Os_Scheduler(void)
 	/* Code is only executed in case there is a new timer tick */
 	if(g_New_Time_Tick_Flag == 1)
 	{
-	    switch(g_Time_Tick_Count)
-            {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
-            }
+	    uint32 Ready = Os_ReadyTable[Os_TickIndex];
+
+	    g_New_Time_Tick_Flag = 0;
+
+#if (OS_CPU_LOAD_API == STD_ON)
+	    /* The load is measured over whole hyperperiods , from one first tick to the next */
+	    if(Os_TickIndex == 0)
+	    {
+		Os_UpdateCpuLoad();
+	    }
+#endif
+
+	    /* Os time of this tick in the hyperperiod */
+	    g_Time_Tick_Count = (Os_TickIndex + 1) * OS_BASE_TIME;
+	    Os_TickIndex = (Os_TickIndex + 1 == OS_HYPERPERIOD_TICKS) ? 0 : (Os_TickIndex + 1);
+
+	    /* Sample all the inputs once, so all the tasks of this tick see the same coherent view */
+	    Dio_TakeSnapshot(g_Time_Tick_Count);
+
+	    /* Run the ready tasks from the highest priority , one CLZ per ready task */
+	    while(Ready != 0)
+	    {
+		uint8 Priority = (uint8)(31U - COUNT_LEADING_ZEROS(Ready));
+
+		Ready &= ~((uint32)1 << Priority);
+		Os_PriorityTask[Priority]();
+	    }
+	}
+	else
+	{
+	    /* Nothing to run until the next tick */
+	    Os_Idle();
 	}
     }
 
@@ -13,23 +13,50 @@
 #define OS_H_
 
 #include "Std_Types.h"
+#include "Os_Cfg.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Number of task priorities , one bit of the ready tasks bitmap each */
+#define OS_PRIORITIES_NUM           (32U)
+
+/* Full scale of the CPU load values : the load is given in 0.01 % */
+#define OS_CPU_LOAD_FULL_SCALE      (10000U)
+
+/* CPU load measured over the hyperperiods , busy cycles over all the cycles in 0.01 % */
+typedef struct
+{
+    uint16 Current;     /* last complete hyperperiod */
+    uint16 Peak;        /* highest hyperperiod since Os_start */
+    uint16 Average;     /* all the hyperperiods since Os_start */
+} Os_CpuLoadType;
+
+/* Periodic task of the task table */
+typedef struct
+{
+    void (*Function)(void);
+    uint32 Period;      /* in Os ticks */
+    uint32 Offset;      /* in Os ticks */
+    uint8  Priority;
+} Os_TaskType;
 
 /* Description: 
  * Function responsible for:
- * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 1. Build the ready tasks table of the hyperperiod from the task table
+ * 2. Enable Interrupts
+ * 3. Start the Os timer
+ * 4. Execute the Init Task
+ * 5. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/* Description: The Engine of the Os Scheduler , runs the tasks ready in every new tick from the highest priority */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+#if (OS_CPU_LOAD_API == STD_ON)
+/* Description: Get the current , peak and average CPU load , all 0 until the first hyperperiod is complete */
+void Os_GetCpuLoad(Os_CpuLoadType * LoadPtr);
+#endif
+
 #endif /* OS_H_ */
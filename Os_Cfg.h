@@ -0,0 +1,45 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Configuration Header file for Os Scheduler - task table.
+ *
+ * Author: Moner Mohammed AKA Orabi :)
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME 20
+
+/* Hyperperiod in ms , the least common multiple of the task periods of OsConf_TASKS ,
+ * every period shall divide it (checked at compile time) */
+#define OS_HYPERPERIOD              (120U)
+
+/* Upper bound of the hyperperiod in Os ticks , the ready tasks table built by Os_start holds
+ * OS_HYPERPERIOD / OS_BASE_TIME words (checked at compile time) */
+#define OS_MAX_HYPERPERIOD_TICKS    (64U)
+
+/* Pre-compile option for the idle path : sleep with WFI between the ticks instead of polling the tick flag ,
+ * the CPU load meter counts the wait as idle in both cases */
+#define OS_IDLE_SLEEP               (STD_ON)
+
+/* Pre-compile option for the CPU load meter , it counts the idle cycles with the Gpt timestamp */
+#define OS_CPU_LOAD_API             (STD_ON)
+
+/*
+ * Periodic tasks , expanded by Os.c into the task table and by its compile time checks:
+ * TASK( Function , Period in ms , Offset in ms , Priority )
+ * - the period and the offset are multiples of OS_BASE_TIME and the offset is below the period ,
+ *   the task runs at the ticks where (time % Period) == Offset , the first tick being OS_BASE_TIME.
+ * - the priority is unique in 0 .. 31 , the tasks ready in the same tick run from the highest priority.
+ */
+#define OsConf_TASKS(TASK) \
+    TASK( Button_Task , 20U , 0U , 3U ) \
+    TASK( App_Task    , 60U , 0U , 2U ) \
+    TASK( Led_Task    , 40U , 0U , 1U )
+
+#endif /* OS_CFG_H_ */
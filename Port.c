@@ -12,6 +12,11 @@
 #include "Port.h"
 #include "tm4c123gh6pm_registers.h"
 
+#if (PORT_INIT_PROFILING == STD_ON)
+/* The Gpt timestamp measures the clock enable of Port_Init */
+#include "Gpt.h"
+#endif
+
 /* Check first if the DET module is enabled */
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -43,307 +48,535 @@
 /*(Step 1)*/STATIC uint8 Port_Status = PORT_NOT_INITIALIZED ;
 /*(Step 2)*/const  Port_ConfigType* Channels_Ptr = NULL_PTR ;
 
-void Port_Init(Port_ConfigType* ConfigPtr){
+/* GPIO Ports base addresses indexed by the Port_Num member (PORT_A .. PORT_F) */
+STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] = {
+        GPIO_PORTA_BASE_ADDRESS , GPIO_PORTB_BASE_ADDRESS , GPIO_PORTC_BASE_ADDRESS ,
+        GPIO_PORTD_BASE_ADDRESS , GPIO_PORTE_BASE_ADDRESS , GPIO_PORTF_BASE_ADDRESS
+};
 
-    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+/* Access the GPIO register at OFFSET of the port having the base address BASE */
+#define PORT_REG(BASE,OFFSET)       (*(volatile uint32 *)((BASE) + (OFFSET)))
 
-        if(NULL_PTR == ConfigPtr){
-            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
-        }else{
-            /*nothing to do here :p */
-        }
+/* RAM shadow of the mode , direction , drive , resistor and interrupt registers of every port ,
+ * and the ports configured by Port_Init */
+STATIC Port_PortShadowType Port_Shadow[PORT_NUMBER_OF_PORTS] ;
+STATIC uint32 Port_UsedPorts = 0 ;
 
-    #endif
+/* Incremented by every shadow update , lets Port_SwitchConfiguration detect a shadow updated by a preempting
+ * task or ISR after its register values were computed */
+STATIC volatile uint32 Port_ShadowGeneration = 0 ;
 
-    /*The ConfigPtr is not null then assign ConfigPtr pointer to Port_Channels. */
-    Channels_Ptr = ConfigPtr ;
-    /* Set the Port_Status to PORT_INITIALIZED */
-    Port_Status = PORT_INITIALIZED ;
+/* Register images of every configuration set and the set currently applied , built by Port_Init */
+STATIC Port_PortRegsType Port_SetImages[PORT_CONFIGURATION_SETS][PORT_NUMBER_OF_PORTS] ;
+STATIC Port_ConfigSetType Port_CurrentSet = 0 ;
+
+/* Configuration sets whose image passed the header and CRC checks of Port_Init , one bit per set */
+STATIC uint32 Port_ValidSets = 0 ;
+
+/* Ports having pins with non changeable direction in every configuration set ,
+ * only these ports are rewritten by Port_RefreshPortDirection */
+STATIC Port_DirRefreshType Port_DirRefresh[PORT_CONFIGURATION_SETS][PORT_NUMBER_OF_PORTS] ;
+STATIC uint8 Port_DirRefreshNum[PORT_CONFIGURATION_SETS] ;
+
+#if (PORT_INIT_PROFILING == STD_ON)
+/* Cycles of the GPIO clocks enable and readiness wait of the last Port_Init */
+uint32 Port_InitClockCycles = 0 ;
+#endif
+
+/* Bits of the Changed member of Port_PortDeltaType , one for each register to be stored */
+#define PORT_DELTA_AMSEL            (uint16)0x0001
+#define PORT_DELTA_PCTL             (uint16)0x0002
+#define PORT_DELTA_AFSEL            (uint16)0x0004
+#define PORT_DELTA_DEN              (uint16)0x0008
+#define PORT_DELTA_DATA             (uint16)0x0010
+#define PORT_DELTA_DIR              (uint16)0x0020
+#define PORT_DELTA_PUR              (uint16)0x0040
+#define PORT_DELTA_PDR              (uint16)0x0080
+#define PORT_DELTA_DR2R             (uint16)0x0100
+#define PORT_DELTA_DR4R             (uint16)0x0200
+#define PORT_DELTA_DR8R             (uint16)0x0400
+#define PORT_DELTA_SLR              (uint16)0x0800
+#define PORT_DELTA_INT              (uint16)0x1000
+
+/* GPIODRxR register offset of each Port_PinDriveType */
+STATIC const uint16 Port_DriveRegOffset[] = {
+        PORT_DRIVE_2MA_REG_OFFSET , PORT_DRIVE_4MA_REG_OFFSET , PORT_DRIVE_8MA_REG_OFFSET
+};
+
+/* Notifications of the pin interrupts indexed by the port and the pin number , set by Port_SetPinNotification */
+STATIC Port_NotificationType Port_PinNotification[PORT_NUMBER_OF_PORTS][8] ;
+
+/* NVIC interrupt number of each GPIO port , all of them are enabled through NVIC_EN0 */
+STATIC const uint8 Port_IrqNumber[PORT_NUMBER_OF_PORTS] = { 0 , 1 , 2 , 3 , 4 , 30 } ;
+
+/* Save PRIMASK and disable the IRQ interrupts around the stores of a configuration switch , then restore
+ * the saved PRIMASK , so a switch called with the interrupts already masked leaves them masked */
+#define PORT_ENTER_CRITICAL_SECTION(STATE)   ((STATE) = SAVE_AND_DISABLE_INTERRUPTS())
+#define PORT_EXIT_CRITICAL_SECTION(STATE)    RESTORE_INTERRUPTS(STATE)
+
+#ifdef PORT_SWITCH_LEVELS_CALLOUT
+/* Callout receiving the initial levels stored to the pins of Mask , owned by the upper layer */
+extern void PORT_SWITCH_LEVELS_CALLOUT(uint8 PortIndex , uint8 Mask , uint8 Level) ;
+#endif
+
+/* Access the 4 PMCx bits of a pin in the GPIOPCTL register */
+#define PORT_PCTL_MASK(PIN)         ((uint32)0x0000000F << ((PIN) * 4))
+#define PORT_PCTL_VALUE(MODE,PIN)   (((uint32)(MODE) & 0x0000000F) << ((PIN) * 4))
+
+/********************************************************************/
+
+/* Description: Store the shadow of the mode registers (GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN) of a port */
+STATIC void Port_StoreModeRegisters(uint8 PortIndex){
+
+    uint32 PortBase = Port_BaseAddress[PortIndex] ;
+
+    PORT_REG(PortBase , PORT_ANALOG_MODE_SEL_REG_OFFSET) = Port_Shadow[PortIndex].Amsel ;
+    PORT_REG(PortBase , PORT_ALT_FUNC_REG_OFFSET)        = Port_Shadow[PortIndex].Afsel ;
+    PORT_REG(PortBase , PORT_CTL_REG_OFFSET)             = Port_Shadow[PortIndex].Pctl ;
+    PORT_REG(PortBase , PORT_DIGITAL_ENABLE_REG_OFFSET)  = Port_Shadow[PortIndex].Den ;
+}
+
+/********************************************************************/
+
+/* Description: Program the pin mode of one pin in the port shadow then store the mode registers.
+ *
+ * DIO pin mode
+ *  1.Disable Analog function for the specified pin. GPIOAMSEL
+ *  2.Clear Alternative functionality for the specified pin. GPIOAFSEL
+ *  3.Clear the pin corresponding 4 PMCx bits in the GPIOPCTL
+ *  4.Enable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
+ *
+ * ADC pin mode
+ *  1.Enable Analog function for the specified pin. GPIOAMSEL
+ *  2.Clear Alternative functionality for the specified pin. GPIOAFSEL
+ *  3.Clear the pin corresponding 4 PMCx bits in the GPIOPCTL
+ *  4.Disable the corresponding I/O pins by writing zero to the corresponding position in GPIODEN.
+ *
+ * Alternative pin mode
+ *  1.Disable Analog function for the specified pin. GPIOAMSEL
+ *  2.Set Alternative functionality for the specified pin. GPIOAFSEL
+ *  3.Set the pin corresponding 4 PMCx bits in the GPIOPCTL with the alternative functionality value.
+ *  4.Enable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
+ */
+STATIC void Port_ProgramPinMode(uint8 PortIndex , Port_PinType Ch_Num , Port_PinModeType Mode){
+
+    Port_PortShadowType* Shadow_Ptr = &Port_Shadow[PortIndex] ;
+    uint8 PinMask = (uint8)(1 << Ch_Num) ;
+    uint32 Interrupts_State ;
+
+    /* The shadow is updated and stored with the interrupts disabled , so a preempting configuration switch
+     * is never reverted by the store of a stale shadow */
+    PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+    if(Mode == PORT_PIN_MODE_DIO){
+        Shadow_Ptr->Amsel &= (uint8)~PinMask ;
+        Shadow_Ptr->Afsel &= (uint8)~PinMask ;
+        Shadow_Ptr->Pctl  &= ~PORT_PCTL_MASK(Ch_Num) ;
+        Shadow_Ptr->Den   |= PinMask ;
+
+    }else if(Mode == PORT_PIN_MODE_ADC){
+        Shadow_Ptr->Amsel |= PinMask ;
+        Shadow_Ptr->Afsel &= (uint8)~PinMask ;
+        Shadow_Ptr->Pctl  &= ~PORT_PCTL_MASK(Ch_Num) ;
+        Shadow_Ptr->Den   &= (uint8)~PinMask ;
+
+    }else if(((Mode >= PORT_PIN_MODE_ALT_1) && (Mode <= PORT_PIN_MODE_ALT_9)) ||
+             ((Mode >= PORT_PIN_MODE_ALT_14) && (Mode <= PORT_PIN_MODE_ALT_15))){
+        Shadow_Ptr->Amsel &= (uint8)~PinMask ;
+        Shadow_Ptr->Afsel |= PinMask ;
+        /* Clear the 4 PMCx bits first then OR the alternative functionality value in place */
+        Shadow_Ptr->Pctl   = (Shadow_Ptr->Pctl & ~PORT_PCTL_MASK(Ch_Num)) | PORT_PCTL_VALUE(Mode , Ch_Num) ;
+        Shadow_Ptr->Den   |= PinMask ;
+
+    }else{
+        /* invalid mode , do nothing */
+        PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
+        return ;
+    }
+
+    Port_ShadowGeneration++ ;
+    Port_StoreModeRegisters(PortIndex) ;
+    PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
+}
+
+/********************************************************************/
 
-    /* Now go through each pin in the Port_ConfigType Array in the Port_PBcfg.c */
+/* Description: Fold the configured pins into one register image per port.
+ *
+ *  The configuration sets are validated at compile time in Port_PBcfg.c (existing pins only ,
+ *  no JTAG pins PC[0:3] , no duplicates and valid modes) , so here it is only register folding.
+ *  PD7 & PF0 are added to the commit mask of their port.
+ */
+STATIC void Port_BuildPortImages(const Port_ConfigType* ConfigPtr , Port_PortRegsType* Images){
+
+    const Port_PortRegsType Empty_Image = {0} ;
     Port_PinType ArrIndex ;
+    uint8 PortIndex ;
+
+    for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+        Images[PortIndex] = Empty_Image ;
+    }
+
     for(ArrIndex = 0 ; ArrIndex < PORT_CONFIGURED_CHANNELS ; ArrIndex++){
 
-        /* We need to declare a pointer that holds the base address of the configured port. */
-        volatile uint32* PortBaseAddress_Ptr = NULL_PTR ;
+        /* The words are scanned in order and each field is decoded with one shift and mask */
+        Port_ConfigChannel Channel = ConfigPtr->Channels[ArrIndex] ;
+        uint8 Port_Num = PORT_CHANNEL_PORT(Channel) ;
+        Port_PinType Ch_Num = PORT_CHANNEL_PIN(Channel) ;
+        Port_PortRegsType* Image_Ptr = &Images[Port_Num] ;
+        uint8 PinMask = (uint8)(1 << Ch_Num) ;
+        Port_PinModeType Mode = PORT_CHANNEL_MODE(Channel) ;
+        Port_PinDriveType Drive = PORT_CHANNEL_DRIVE(Channel) ;
+        Port_InternalResistor Resistor = PORT_CHANNEL_RESISTOR(Channel) ;
+
+        /* Locked pins PD7 & PF0 */
+        if( ( (Port_Num == PORT_D) && (Ch_Num == PORT_PIN_7) )
+         || ( (Port_Num == PORT_F) && (Ch_Num == PORT_PIN_0) ) ){
+            Image_Ptr->Commit_Mask |= PinMask ;
+        }
 
-        /* Also we need Error variable to check for example : pin number not in range , invalid port number and invalid mode. */
-        boolean error = FALSE ;
+        /* Mode : the PMCx nibble is cleared for DIO and ADC and holds the mode for alternative functions */
+        Image_Ptr->Mode_Mask |= PinMask ;
+        Image_Ptr->Pctl_Mask |= PORT_PCTL_MASK(Ch_Num) ;
+        if(Mode == PORT_PIN_MODE_DIO){
+            Image_Ptr->Den |= PinMask ;
+        }else if(Mode == PORT_PIN_MODE_ADC){
+            Image_Ptr->Amsel |= PinMask ;
+        }else{
+            Image_Ptr->Afsel |= PinMask ;
+            Image_Ptr->Den   |= PinMask ;
+            Image_Ptr->Pctl  |= PORT_PCTL_VALUE(Mode , Ch_Num) ;
+        }
 
-        /* Now check for the port number validity */
-        switch(Channels_Ptr->Channels[ArrIndex].Port_Num){
-            case PORT_A:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTA_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_B:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTB_BASE_ADDRESS; /* Casting to volatile uint32* */
+        /* Drive strength : only one of GPIODR2R , GPIODR4R and GPIODR8R has the pin bit set */
+        if(Drive == PORT_PIN_DRIVE_8MA){
+            Image_Ptr->Dr8r |= PinMask ;
+        }else if(Drive == PORT_PIN_DRIVE_4MA){
+            Image_Ptr->Dr4r |= PinMask ;
+        }else{
+            Image_Ptr->Dr2r |= PinMask ;
+        }
+        if(PORT_CHANNEL_SLEW(Channel) == STD_ON){
+            Image_Ptr->Slr |= PinMask ;
+        }
+
+        /* Interrupt : edge or level sense , both edges , event polarity and the mask enabling it */
+        switch(PORT_CHANNEL_INTERRUPT(Channel)){
+            case PORT_PIN_INTERRUPT_FALLING_EDGE:
+                Image_Ptr->Im  |= PinMask ;
                 break;
-            case PORT_C:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTC_BASE_ADDRESS; /* Casting to volatile uint32* */
+            case PORT_PIN_INTERRUPT_RISING_EDGE:
+                Image_Ptr->Iev |= PinMask ;
+                Image_Ptr->Im  |= PinMask ;
                 break;
-            case PORT_D:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTD_BASE_ADDRESS; /* Casting to volatile uint32* */
+            case PORT_PIN_INTERRUPT_BOTH_EDGES:
+                Image_Ptr->Ibe |= PinMask ;
+                Image_Ptr->Im  |= PinMask ;
                 break;
-            case PORT_E:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTE_BASE_ADDRESS; /* Casting to volatile uint32* */
+            case PORT_PIN_INTERRUPT_LOW_LEVEL:
+                Image_Ptr->Is  |= PinMask ;
+                Image_Ptr->Im  |= PinMask ;
                 break;
-            case PORT_F:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTF_BASE_ADDRESS; /* Casting to volatile uint32* */
+            case PORT_PIN_INTERRUPT_HIGH_LEVEL:
+                Image_Ptr->Is  |= PinMask ;
+                Image_Ptr->Iev |= PinMask ;
+                Image_Ptr->Im  |= PinMask ;
                 break;
             default:
-                /* This case means that we have an invalid input for Port */
-                //error = TRUE ;
+                /* PORT_PIN_INTERRUPT_NONE , the pin stays masked */
                 break;
         }
 
-        /* Now we check if the port_num is correct or not , if yes enable clock if not do nothing. */
-        if(TRUE == error){
-            /* Do nothing because we have invalid port_num input :P */
-        }else{
-            /* Here activate the clock for the port using SYSCTL_RCGCGPIO_REG. */
-            SYSCTL_RCGCGPIO_REG |= (1<<Channels_Ptr->Channels[ArrIndex].Port_Num) ;
-
-            /* Wait for the flag to be fired in PRGPIO register (should be fired within 3 CLK cycles. */
-            while(!(SYSCTL_PRGPIO_REG & (1<<Channels_Ptr->Channels[ArrIndex].Port_Num) ) );
+        /* Direction : initial level for output pins and internal resistor for input pins ,
+         * both resistors are disabled on the output pins so no resistor of a previous set stays connected */
+        Image_Ptr->Dir_Mask  |= PinMask ;
+        Image_Ptr->Pull_Mask |= PinMask ;
+        if(PORT_CHANNEL_DIR_CHANGEABLE(Channel) == STD_OFF){
+            Image_Ptr->Refresh_Mask |= PinMask ;
         }
-
-
-        /* Now we check for the validity of pin number */
-        /*Cases :
-         * PORT A,B,C,D have 0-7 range of pins
-         * PORT E have 0-5 range of pins
-         * PORT F have 0-4 range of pins
-         */
-        if(TRUE == error){
-            /* Do nothing because we have invalid port_num input :P */
-        }else{
-            if((Channels_Ptr->Channels[ArrIndex].Port_Num >= PORT_A) && (Channels_Ptr->Channels[ArrIndex].Port_Num <= PORT_D)){
-                /* Here we should check if the pin is in the range of 0-7 */
-                if((Channels_Ptr->Channels[ArrIndex].Ch_Num >= PORT_PIN_0)
-                 &&(Channels_Ptr->Channels[ArrIndex].Ch_Num <= PORT_PIN_7)){
-                    /* nothing to do here pin num is correct :-) */
-                }else{
-                    /* pin number is incorrect here */
-                    //error = TRUE ;
-                }
+        if(PORT_CHANNEL_DIRECTION(Channel) == PORT_PIN_OUT){
+            Image_Ptr->Dir       |= PinMask ;
+            Image_Ptr->Data_Mask |= PinMask ;
+            if(PORT_CHANNEL_LEVEL(Channel) == PORT_PIN_LEVEL_HIGH){
+                Image_Ptr->Data |= PinMask ;
             }
-
-            if(Channels_Ptr->Channels[ArrIndex].Port_Num == PORT_E){
-                /* Here we should check if the pin is in the range of 0-7 */
-                if((Channels_Ptr->Channels[ArrIndex].Ch_Num >= PORT_PIN_0)
-                 &&(Channels_Ptr->Channels[ArrIndex].Ch_Num <= PORT_PIN_5)){
-                    /* nothing to do here pin num is correct :-) */
-                }else{
-                    /* pin number is incorrect here */
-                    //error = TRUE ;
-                }
-            }
-
-            if(Channels_Ptr->Channels[ArrIndex].Port_Num == PORT_F){
-                /* Here we should check if the pin is in the range of 0-7 */
-                if((Channels_Ptr->Channels[ArrIndex].Ch_Num >= PORT_PIN_0)
-                 &&(Channels_Ptr->Channels[ArrIndex].Ch_Num <= PORT_PIN_4)){
-                    /* nothing to do here pin num is correct :-) */
-                }else{
-                    /* pin number is incorrect here */
-                    //error = TRUE ;
-                }
+        }else{
+            if(Resistor == PULL_UP){
+                Image_Ptr->Pur |= PinMask ;
+            }else if(Resistor == PULL_DOWN){
+                Image_Ptr->Pdr |= PinMask ;
+            }else{
+                /* OFF , both resistors disabled */
             }
-
         }
+    }
+}
 
+/********************************************************************/
 
+/* Description: Compute the values of the registers of a port after applying its image of a configuration set
+ *              over the port shadow , and mark the registers that really change.
+ *  Only the port shadow is read , no register is accessed.
+ *  Only the initial levels of the pins turning from input to output are written , the pins that are
+ *  already outputs keep the level driven by Dio.
+ */
+STATIC void Port_ComputeDelta(uint8 PortIndex , const Port_PortRegsType* Image_Ptr , Port_PortDeltaType* Delta_Ptr){
+
+    const Port_PortShadowType* Shadow_Ptr = &Port_Shadow[PortIndex] ;
+
+    Delta_Ptr->Changed   = 0 ;
+    Delta_Ptr->Amsel     = (uint8)((Shadow_Ptr->Amsel & ~Image_Ptr->Mode_Mask) | Image_Ptr->Amsel) ;
+    Delta_Ptr->Afsel     = (uint8)((Shadow_Ptr->Afsel & ~Image_Ptr->Mode_Mask) | Image_Ptr->Afsel) ;
+    Delta_Ptr->Den       = (uint8)((Shadow_Ptr->Den   & ~Image_Ptr->Mode_Mask) | Image_Ptr->Den) ;
+    Delta_Ptr->Pctl      = (Shadow_Ptr->Pctl & ~Image_Ptr->Pctl_Mask) | Image_Ptr->Pctl ;
+    Delta_Ptr->Dir       = (uint8)((Shadow_Ptr->Dir   & ~Image_Ptr->Dir_Mask)  | Image_Ptr->Dir) ;
+    Delta_Ptr->Data_Mask = (uint8)(Image_Ptr->Data_Mask & ~Shadow_Ptr->Dir) ;
+    Delta_Ptr->Data      = Image_Ptr->Data ;
+
+    if(Delta_Ptr->Amsel != Shadow_Ptr->Amsel) { Delta_Ptr->Changed |= PORT_DELTA_AMSEL ; }
+    if(Delta_Ptr->Pctl  != Shadow_Ptr->Pctl)  { Delta_Ptr->Changed |= PORT_DELTA_PCTL ;  }
+    if(Delta_Ptr->Afsel != Shadow_Ptr->Afsel) { Delta_Ptr->Changed |= PORT_DELTA_AFSEL ; }
+    if(Delta_Ptr->Den   != Shadow_Ptr->Den)   { Delta_Ptr->Changed |= PORT_DELTA_DEN ;   }
+    if(Delta_Ptr->Data_Mask != 0)             { Delta_Ptr->Changed |= PORT_DELTA_DATA ;  }
+    if(Delta_Ptr->Dir   != Shadow_Ptr->Dir)   { Delta_Ptr->Changed |= PORT_DELTA_DIR ;   }
+
+    /* The internal resistors of the configured pins */
+    Delta_Ptr->Pur = (uint8)((Shadow_Ptr->Pur & ~Image_Ptr->Pull_Mask) | Image_Ptr->Pur) ;
+    Delta_Ptr->Pdr = (uint8)((Shadow_Ptr->Pdr & ~Image_Ptr->Pull_Mask) | Image_Ptr->Pdr) ;
+    if(Delta_Ptr->Pur != Shadow_Ptr->Pur) { Delta_Ptr->Changed |= PORT_DELTA_PUR ; }
+    if(Delta_Ptr->Pdr != Shadow_Ptr->Pdr) { Delta_Ptr->Changed |= PORT_DELTA_PDR ; }
+
+    /* The drive strength and slew rate registers come from the shadow , all the configured pins have a drive */
+    Delta_Ptr->Dr2r = (uint8)((Shadow_Ptr->Dr2r & ~Image_Ptr->Mode_Mask) | Image_Ptr->Dr2r) ;
+    Delta_Ptr->Dr4r = (uint8)((Shadow_Ptr->Dr4r & ~Image_Ptr->Mode_Mask) | Image_Ptr->Dr4r) ;
+    Delta_Ptr->Dr8r = (uint8)((Shadow_Ptr->Dr8r & ~Image_Ptr->Mode_Mask) | Image_Ptr->Dr8r) ;
+    Delta_Ptr->Slr  = (uint8)((Shadow_Ptr->Slr  & ~Image_Ptr->Mode_Mask) | Image_Ptr->Slr) ;
+    if(Delta_Ptr->Dr2r != Shadow_Ptr->Dr2r) { Delta_Ptr->Changed |= PORT_DELTA_DR2R ; }
+    if(Delta_Ptr->Dr4r != Shadow_Ptr->Dr4r) { Delta_Ptr->Changed |= PORT_DELTA_DR4R ; }
+    if(Delta_Ptr->Dr8r != Shadow_Ptr->Dr8r) { Delta_Ptr->Changed |= PORT_DELTA_DR8R ; }
+    if(Delta_Ptr->Slr  != Shadow_Ptr->Slr)  { Delta_Ptr->Changed |= PORT_DELTA_SLR ;  }
+
+    /* The interrupt registers are stored together , only the pins whose interrupt changes are reconfigured */
+    Delta_Ptr->Is  = (uint8)((Shadow_Ptr->Is  & ~Image_Ptr->Mode_Mask) | Image_Ptr->Is) ;
+    Delta_Ptr->Ibe = (uint8)((Shadow_Ptr->Ibe & ~Image_Ptr->Mode_Mask) | Image_Ptr->Ibe) ;
+    Delta_Ptr->Iev = (uint8)((Shadow_Ptr->Iev & ~Image_Ptr->Mode_Mask) | Image_Ptr->Iev) ;
+    Delta_Ptr->Im  = (uint8)((Shadow_Ptr->Im  & ~Image_Ptr->Mode_Mask) | Image_Ptr->Im) ;
+    Delta_Ptr->Int_Mask = (uint8)((Delta_Ptr->Is  ^ Shadow_Ptr->Is)  | (Delta_Ptr->Ibe ^ Shadow_Ptr->Ibe)
+                                | (Delta_Ptr->Iev ^ Shadow_Ptr->Iev) | (Delta_Ptr->Im  ^ Shadow_Ptr->Im)) ;
+    if(Delta_Ptr->Int_Mask != 0) { Delta_Ptr->Changed |= PORT_DELTA_INT ; }
+}
 
+/********************************************************************/
 
-        /* Now we need to unlock the port and enable the commit to the corresponding pin
-         * but only special pins that needs to be unlocked and we are going to mention them below,
-         * Special Cases :
-         * PD7 & PF0 for NMI pins .
-         * PC[0:3] for JTAG/SWD pins.
-         */
-        if(TRUE == error){
+/* Description: Store the changed registers of a port computed by Port_ComputeDelta and update the port shadow ,
+ *              the initial levels stored are reported through PORT_SWITCH_LEVELS_CALLOUT.
+ *  The mode is stored before the initial levels , and the levels before the direction ,
+ *  so no pin drives an output before its function and level are set.
+ *  Setting a bit in GPIOPUR clears it in GPIOPDR and vice versa , so both are stored in this order ,
+ *  the same for GPIODR2R , GPIODR4R and GPIODR8R , then GPIOSLR once the 8mA drive is selected.
+ *  The reconfigured interrupts are masked while their sense is changed , then the interrupts raised
+ *  by the change are cleared before the mask is stored.
+ */
+STATIC void Port_ApplyDelta(uint8 PortIndex , const Port_PortDeltaType* Delta_Ptr){
+
+    Port_PortShadowType* Shadow_Ptr = &Port_Shadow[PortIndex] ;
+    uint32 PortBase = Port_BaseAddress[PortIndex] ;
+
+    if(Delta_Ptr->Changed & PORT_DELTA_AMSEL){ PORT_REG(PortBase , PORT_ANALOG_MODE_SEL_REG_OFFSET) = Delta_Ptr->Amsel ; }
+    if(Delta_Ptr->Changed & PORT_DELTA_PCTL) { PORT_REG(PortBase , PORT_CTL_REG_OFFSET)             = Delta_Ptr->Pctl ;  }
+    if(Delta_Ptr->Changed & PORT_DELTA_AFSEL){ PORT_REG(PortBase , PORT_ALT_FUNC_REG_OFFSET)        = Delta_Ptr->Afsel ; }
+    if(Delta_Ptr->Changed & PORT_DELTA_DEN)  { PORT_REG(PortBase , PORT_DIGITAL_ENABLE_REG_OFFSET)  = Delta_Ptr->Den ;   }
+    if(Delta_Ptr->Changed & PORT_DELTA_DATA) {
+        PORT_REG(PortBase , PORT_DATA_MASKED_REG_OFFSET(Delta_Ptr->Data_Mask)) = Delta_Ptr->Data ;
+    #ifdef PORT_SWITCH_LEVELS_CALLOUT
+        PORT_SWITCH_LEVELS_CALLOUT(PortIndex , Delta_Ptr->Data_Mask , Delta_Ptr->Data) ;
+    #endif
+    }
+    if(Delta_Ptr->Changed & PORT_DELTA_DIR)  { PORT_REG(PortBase , PORT_DIR_REG_OFFSET)             = Delta_Ptr->Dir ;   }
+    if(Delta_Ptr->Changed & PORT_DELTA_PUR)  { PORT_REG(PortBase , PORT_PULL_UP_REG_OFFSET)         = Delta_Ptr->Pur ;   }
+    if(Delta_Ptr->Changed & PORT_DELTA_PDR)  { PORT_REG(PortBase , PORT_PULL_DOWN_REG_OFFSET)       = Delta_Ptr->Pdr ;   }
+    if(Delta_Ptr->Changed & PORT_DELTA_DR2R) { PORT_REG(PortBase , PORT_DRIVE_2MA_REG_OFFSET)       = Delta_Ptr->Dr2r ;  }
+    if(Delta_Ptr->Changed & PORT_DELTA_DR4R) { PORT_REG(PortBase , PORT_DRIVE_4MA_REG_OFFSET)       = Delta_Ptr->Dr4r ;  }
+    if(Delta_Ptr->Changed & PORT_DELTA_DR8R) { PORT_REG(PortBase , PORT_DRIVE_8MA_REG_OFFSET)       = Delta_Ptr->Dr8r ;  }
+    if(Delta_Ptr->Changed & PORT_DELTA_SLR)  { PORT_REG(PortBase , PORT_SLEW_RATE_REG_OFFSET)       = Delta_Ptr->Slr ;   }
+    if(Delta_Ptr->Changed & PORT_DELTA_INT){
+        PORT_REG(PortBase , PORT_INT_MASK_REG_OFFSET)       = (uint8)(Delta_Ptr->Im & ~Delta_Ptr->Int_Mask) ;
+        PORT_REG(PortBase , PORT_INT_SENSE_REG_OFFSET)      = Delta_Ptr->Is ;
+        PORT_REG(PortBase , PORT_INT_BOTH_EDGES_REG_OFFSET) = Delta_Ptr->Ibe ;
+        PORT_REG(PortBase , PORT_INT_EVENT_REG_OFFSET)      = Delta_Ptr->Iev ;
+        PORT_REG(PortBase , PORT_INT_CLEAR_REG_OFFSET)      = Delta_Ptr->Int_Mask ;
+        PORT_REG(PortBase , PORT_INT_MASK_REG_OFFSET)       = Delta_Ptr->Im ;
+    }
 
-        }else if( ( (Channels_Ptr->Channels[ArrIndex].Port_Num == 3 ) && (Channels_Ptr->Channels[ArrIndex].Ch_Num == 7 ) )
-              || ( (Channels_Ptr->Channels[ArrIndex].Port_Num == 5) && (Channels_Ptr->Channels[ArrIndex].Ch_Num  == 0) ) ){
+    Shadow_Ptr->Amsel = Delta_Ptr->Amsel ;
+    Shadow_Ptr->Pctl  = Delta_Ptr->Pctl ;
+    Shadow_Ptr->Afsel = Delta_Ptr->Afsel ;
+    Shadow_Ptr->Den   = Delta_Ptr->Den ;
+    Shadow_Ptr->Dir   = Delta_Ptr->Dir ;
+    Shadow_Ptr->Dr2r  = Delta_Ptr->Dr2r ;
+    Shadow_Ptr->Dr4r  = Delta_Ptr->Dr4r ;
+    Shadow_Ptr->Dr8r  = Delta_Ptr->Dr8r ;
+    Shadow_Ptr->Slr   = Delta_Ptr->Slr ;
+    Shadow_Ptr->Pur   = Delta_Ptr->Pur ;
+    Shadow_Ptr->Pdr   = Delta_Ptr->Pdr ;
+    Shadow_Ptr->Is    = Delta_Ptr->Is ;
+    Shadow_Ptr->Ibe   = Delta_Ptr->Ibe ;
+    Shadow_Ptr->Iev   = Delta_Ptr->Iev ;
+    Shadow_Ptr->Im    = Delta_Ptr->Im ;
+    Port_ShadowGeneration++ ;
+}
 
-            /* Here we are checking if the pin is either PD7 or PF0 in order to unlock the
-             * corresponding LOCK register GPIOLOCK with value 0x4C4F434B and Set the corresponding bit
-             * in the GPIOCR commit register.
-             */
+/********************************************************************/
+void Port_Init(const Port_ConfigType* ConfigPtr){
 
-            /* Unlocking */
-            *(volatile uint32 *)((volatile uint8*)PortBaseAddress_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B ;
+    Port_ConfigSetType SetIndex ;
+    uint8 PortIndex ;
+    uint32 Used_Ports = 0 ;
+    uint32 Irq_Ports = 0 ;
+    uint8 Commit_Mask[PORT_NUMBER_OF_PORTS] = {0} ;
 
-            /* Setting Corresponding bit to enable commit */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_COMMIT_REG_OFFSET) ,
-                    Channels_Ptr->Channels[ArrIndex].Ch_Num) ;
+    /* ConfigPtr shall point to one of the configuration set slots in Port_PBcfg.c */
+    if((ConfigPtr < &Port_ConfigurationSets[0]) || (ConfigPtr >= &Port_ConfigurationSets[PORT_CONFIGURATION_SETS])){
 
-        }else if( (Channels_Ptr->Channels[ArrIndex].Port_Num == PORT_C) && (Channels_Ptr->Channels[ArrIndex].Ch_Num <= 3) ){
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+    #endif
+        return ;
+    }
 
-            /* Here we checked if the passed configuration JTAG pins PC[0:3] */
-            /* We can just leave and don't modify it so I'm going to use continue keyword */
-            continue ;
+    /* Check the image of every set once , the sets failing the header or the CRC checks are never applied */
+    Port_ValidSets = 0 ;
+    for(SetIndex = 0 ; SetIndex < PORT_CONFIGURATION_SETS ; SetIndex++){
 
-        }else{
-            /* No need to do anything here all other pins are hard wired to 0x01
-             * ensuring that it is always possible to commit new values
-             * to the AFSEL , PUD , PDR , DEN registers.
-             */
+        const Config_ImageHeaderType Expected = CONFIG_IMAGE_HEADER(PORT , SetIndex , PORT_CONFIG_IMAGE_LENGTH , 0U) ;
+
+        if(Config_ImageIsValid(&Port_ConfigurationSets[SetIndex].Header , &Expected)){
+            Port_ValidSets |= (1<<SetIndex) ;
         }
+    }
+
+    /* The slot index is the set index , no search is needed */
+    SetIndex = (Port_ConfigSetType)(ConfigPtr - &Port_ConfigurationSets[0]) ;
+    if(!(Port_ValidSets & (1<<SetIndex))){
 
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+    #endif
+        return ;
+    }
 
-        /* Now hold mode configuration */
+    /*The ConfigPtr is valid then assign ConfigPtr pointer to Port_Channels. */
+    Channels_Ptr = ConfigPtr ;
+    Port_CurrentSet = SetIndex ;
+    /* Set the Port_Status to PORT_INITIALIZED */
+    Port_Status = PORT_INITIALIZED ;
 
-        /* First we will hold the DIO pin mode
-         * 1.Disable Analog function for the specified pin. GPIOAMSEL
-         * 2.Clear Alternative functionality for the specified pin. GPIOAFSEL
-         * 3.Clear the pin corresponding 4 PMCx bits in the GPIOPCTL
-         * 4.Enable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
-         */
-        if(TRUE == error){
-
-            /* you have an error from the upper procedures */
-
-        }else if(Channels_Ptr->Channels[ArrIndex].Ch_Mode == PORT_PIN_MODE_DIO){
-
-            /* Step 1 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ,
-                     Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-            /* Step 2 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ALT_FUNC_REG_OFFSET) ,
-                      Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-            /* the register value anded with zeros at 4 * Ch_Num  (Step 3) */
-            *(volatile uint32*)((volatile uint8 *)PortBaseAddress_Ptr + PORT_CTL_REG_OFFSET) &=
-                    ~(0x0000000F << (Channels_Ptr->Channels[ArrIndex].Ch_Num * 4)) ;
-
-            /* Step 4 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) ,
-                    Channels_Ptr->Channels[ArrIndex].Ch_Num);
-        }else if(Channels_Ptr->Channels[ArrIndex].Ch_Mode == PORT_PIN_MODE_ADC){
-
-            /* ADC pin mode
-             * 1.Enable Analog function for the specified pin. GPIOAMSEL
-             * 2.Clear Alternative functionality for the specified pin. GPIOAFSEL
-             * 3.Clear the pin corresponding 4 PMCx bits in the GPIOPCTL
-             * 4.Disable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
-             */
-
-            /* Step 1 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ,
-                     Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-            /* Step 2 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ALT_FUNC_REG_OFFSET) ,
-                      Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-            /* the register value anded with zeros at 4 * Ch_Num  (Step 3) */
-            *(volatile uint32*)((volatile uint8 *)PortBaseAddress_Ptr + PORT_CTL_REG_OFFSET) &=
-                    ~(0x0000000F << (Channels_Ptr->Channels[ArrIndex].Ch_Num * 4)) ;
-
-            /* Step 4 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) ,
-                    Channels_Ptr->Channels[ArrIndex].Ch_Num);
-        }else if(((Channels_Ptr->Channels[ArrIndex].Ch_Mode >= PORT_PIN_MODE_ALT_1) &&
-                (Channels_Ptr->Channels[ArrIndex].Ch_Mode <= PORT_PIN_MODE_ALT_9)) ||
-                ((Channels_Ptr->Channels[ArrIndex].Ch_Mode >= PORT_PIN_MODE_ALT_14) &&
-                (Channels_Ptr->Channels[ArrIndex].Ch_Mode <= PORT_PIN_MODE_ALT_15))){
-
-            /* Here we are dealing with alternative functions for pins */
-            /* Alternative pin mode
-             * 1.Disable Analog function for the specified pin. GPIOAMSEL
-             * 2.Set Alternative functionality for the specified pin. GPIOAFSEL
-             * 3.Set the pin corresponding 4 PMCx bits in the GPIOPCTL with the alternative functionality value.
-             * 4.Enable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
-             */
-            /* Step 1 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ,
-                     Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-            /* Step 2 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ALT_FUNC_REG_OFFSET) ,
-                      Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-            /* the register value OR'ed with alternative functionality value at shifted position
-             * to the left with value equal to (4 * Ch_Num)  (Step 3) */
-            *(volatile uint32*)((volatile uint8 *)PortBaseAddress_Ptr + PORT_CTL_REG_OFFSET) |=
-                    (Channels_Ptr->Channels[ArrIndex].Ch_Mode & 0x0000000F <<
-                    (Channels_Ptr->Channels[ArrIndex].Ch_Num * 4)) ;
-
-            /* Step 4 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) ,
-                    Channels_Ptr->Channels[ArrIndex].Ch_Num);
+    /* First fold the pins of every valid configuration set into one register image per port ,
+     * and collect the ports and the locked pins used by any of the sets.
+     */
+    for(SetIndex = 0 ; SetIndex < PORT_CONFIGURATION_SETS ; SetIndex++){
 
+        if(Port_ValidSets & (1<<SetIndex)){
+            Port_BuildPortImages(&Port_ConfigurationSets[SetIndex] , Port_SetImages[SetIndex]) ;
         }else{
-            //error = TRUE ;
+            /* Empty images , the set is rejected by Port_SwitchConfiguration */
+            const Port_PortRegsType Empty_Image = {0} ;
+
+            for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+                Port_SetImages[SetIndex][PortIndex] = Empty_Image ;
+            }
         }
 
+        Port_DirRefreshNum[SetIndex] = 0 ;
+        for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
 
-        /* Now we want to handle the Direction
-         *
-         * OUTPUT Cases :
-         * Check for Initial value and set the initial value.
-         *
-         *
-         * INPUT Cases :
-         * Pull Up Resistor or Pull Down Resistor or neither.
-         *
-         *
-         */
-         if(TRUE == error){
+            const Port_PortRegsType* Image_Ptr = &Port_SetImages[SetIndex][PortIndex] ;
 
-         }else if(Channels_Ptr->Channels[ArrIndex].Ch_Direction == PORT_PIN_OUT){
+            if((Image_Ptr->Mode_Mask | Image_Ptr->Dir_Mask | Image_Ptr->Commit_Mask) != 0){
+                Used_Ports |= (1<<PortIndex) ;
+            }
+            Commit_Mask[PortIndex] |= Image_Ptr->Commit_Mask ;
+            if(Image_Ptr->Im != 0){
+                Irq_Ports |= (1<<PortIndex) ;
+            }
 
-             /* Set the corresponding bit in GPIODIR register in order to make the direction output */
-             SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIR_REG_OFFSET) ,
-                     Channels_Ptr->Channels[ArrIndex].Ch_Num) ;
+            /* Keep the non changeable direction pins of this port for Port_RefreshPortDirection */
+            if(Image_Ptr->Refresh_Mask != 0){
+                Port_DirRefreshType* Refresh_Ptr = &Port_DirRefresh[SetIndex][Port_DirRefreshNum[SetIndex]] ;
 
-             /* Now check for the initial value */
-             if(Channels_Ptr->Channels[ArrIndex].Ch_Initial_value == PORT_PIN_LEVEL_LOW){
-                 /* CLEAR the corresponding bit in the data register GPIODATA */
+                Refresh_Ptr->PortIndex = PortIndex ;
+                Refresh_Ptr->Mask      = Image_Ptr->Refresh_Mask ;
+                Refresh_Ptr->Dir       = (uint8)(Image_Ptr->Dir & Image_Ptr->Refresh_Mask) ;
+                Port_DirRefreshNum[SetIndex]++ ;
+            }
+        }
+    }
 
-                 CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DATA_REG_OFFSET) ,
-                         Channels_Ptr->Channels[ArrIndex].Ch_Num) ;
+#if (PORT_INIT_PROFILING == STD_ON)
+    Port_InitClockCycles = Gpt_GetTimestampLow() ;
+#endif
 
-             }else{
-                 /* else case is of course PORT_PIN_LEVEL_HIGH */
+    /* Here activate the clock for all the used ports at once using SYSCTL_RCGCGPIO_REG. */
+    SYSCTL_RCGCGPIO_REG |= Used_Ports ;
 
-                 SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DATA_REG_OFFSET) ,
-                         Channels_Ptr->Channels[ArrIndex].Ch_Num) ;
-             }
-         }else if(Channels_Ptr->Channels[ArrIndex].Ch_Direction == PORT_PIN_IN){
-             /* CLEAR the corresponding bit in GPIODIR register in order to make the direction INPUT */
-             CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIR_REG_OFFSET) ,
-                     Channels_Ptr->Channels[ArrIndex].Ch_Num) ;
+    /* Wait once for all of them to be fired in PRGPIO register (should be fired within 3 CLK cycles. */
+    while((SYSCTL_PRGPIO_REG & Used_Ports) != Used_Ports);
 
-             /* Check the Internal Resistor cases OFF - Pull Up - Pull Down*/
-             if(Channels_Ptr->Channels[ArrIndex].Resistor == PULL_UP){
-                 /* Pull Up Resistor Enable */
-                 SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_PULL_UP_REG_OFFSET) ,
-                         Channels_Ptr->Channels[ArrIndex].Ch_Num);
+#if (PORT_INIT_PROFILING == STD_ON)
+    Port_InitClockCycles = Gpt_GetTimestampLow() - Port_InitClockCycles ;
+#endif
 
-             }else if(Channels_Ptr->Channels[ArrIndex].Resistor == PULL_DOWN){
-                 /* Pull Down Resistor Enable */
-                 SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_PULL_DOWN_REG_OFFSET) ,
-                         Channels_Ptr->Channels[ArrIndex].Ch_Num);
+#if (PORT_GPIO_AHB_ACCESS == STD_ON)
+    /* Move the used ports to the AHB aperture before accessing any of their registers */
+    SYSCTL_GPIOHBCTL_REG |= Used_Ports ;
+#endif
 
-             }else if(Channels_Ptr->Channels[ArrIndex].Resistor == OFF){
-                 /* Disable Pulled Resistors */
-                 CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_PULL_DOWN_REG_OFFSET) ,
-                         Channels_Ptr->Channels[ArrIndex].Ch_Num);
+    Port_UsedPorts = Used_Ports ;
 
-                 CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_PULL_UP_REG_OFFSET) ,
-                         Channels_Ptr->Channels[ArrIndex].Ch_Num);
+    /* Then program each used port with the image of the selected set , every register is written once
+     * with all of its configured pins: the pins out of the image masks keep their current values.
+     * The mode and direction registers are read once here into the port shadow and only stored afterwards.
+     */
+    for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
 
-             }else{
-                 //error = TRUE ;
-             }
+        Port_PortShadowType* Shadow_Ptr = &Port_Shadow[PortIndex] ;
+        uint32 PortBase = Port_BaseAddress[PortIndex] ;
+        Port_PortDeltaType Delta ;
 
-         }else{
-             //error = TRUE ;
-         }
+        if(!(Used_Ports & (1<<PortIndex))){
+            /* No configured pins in this port */
+            continue ;
+        }
+
+        /* Unlock the port once and commit all of its locked pins (PD7 & PF0) used by any set */
+        if(Commit_Mask[PortIndex] != 0){
+            PORT_REG(PortBase , PORT_LOCK_REG_OFFSET)    = 0x4C4F434B ;
+            PORT_REG(PortBase , PORT_COMMIT_REG_OFFSET) |= Commit_Mask[PortIndex] ;
+        }
 
+        /* Load the port shadow from the hardware */
+        Shadow_Ptr->Dir   = (uint8)PORT_REG(PortBase , PORT_DIR_REG_OFFSET) ;
+        Shadow_Ptr->Den   = (uint8)PORT_REG(PortBase , PORT_DIGITAL_ENABLE_REG_OFFSET) ;
+        Shadow_Ptr->Afsel = (uint8)PORT_REG(PortBase , PORT_ALT_FUNC_REG_OFFSET) ;
+        Shadow_Ptr->Amsel = (uint8)PORT_REG(PortBase , PORT_ANALOG_MODE_SEL_REG_OFFSET) ;
+        Shadow_Ptr->Pctl  = PORT_REG(PortBase , PORT_CTL_REG_OFFSET) ;
+        Shadow_Ptr->Dr2r  = (uint8)PORT_REG(PortBase , PORT_DRIVE_2MA_REG_OFFSET) ;
+        Shadow_Ptr->Dr4r  = (uint8)PORT_REG(PortBase , PORT_DRIVE_4MA_REG_OFFSET) ;
+        Shadow_Ptr->Dr8r  = (uint8)PORT_REG(PortBase , PORT_DRIVE_8MA_REG_OFFSET) ;
+        Shadow_Ptr->Slr   = (uint8)PORT_REG(PortBase , PORT_SLEW_RATE_REG_OFFSET) ;
+        Shadow_Ptr->Pur   = (uint8)PORT_REG(PortBase , PORT_PULL_UP_REG_OFFSET) ;
+        Shadow_Ptr->Pdr   = (uint8)PORT_REG(PortBase , PORT_PULL_DOWN_REG_OFFSET) ;
+        Shadow_Ptr->Is    = (uint8)PORT_REG(PortBase , PORT_INT_SENSE_REG_OFFSET) ;
+        Shadow_Ptr->Ibe   = (uint8)PORT_REG(PortBase , PORT_INT_BOTH_EDGES_REG_OFFSET) ;
+        Shadow_Ptr->Iev   = (uint8)PORT_REG(PortBase , PORT_INT_EVENT_REG_OFFSET) ;
+        Shadow_Ptr->Im    = (uint8)PORT_REG(PortBase , PORT_INT_MASK_REG_OFFSET) ;
+
+        Port_ComputeDelta(PortIndex , &Port_SetImages[Port_CurrentSet][PortIndex] , &Delta) ;
+        Port_ApplyDelta(PortIndex , &Delta) ;
+
+        /* Enable the NVIC interrupt of the ports having interrupt pins in any set , the pins are masked in GPIOIM */
+        if(Irq_Ports & (1<<PortIndex)){
+            NVIC_EN0_REG = ((uint32)1 << Port_IrqNumber[PortIndex]) ;
+        }
     }
 }
 /********************************************************************/
@@ -362,6 +595,7 @@ void Port_SetPinDirection(Port_PinType Pin , Port_PinDirectionType Direction){
         /* PORT_E_UNINIT - Port module not initialized.  */
         if(Port_Status == PORT_NOT_INITIALIZED) {
             Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
+            return ;
         }else{
             /* nothing to do */
         }
@@ -369,65 +603,44 @@ void Port_SetPinDirection(Port_PinType Pin , Port_PinDirectionType Direction){
         /* PORT_E_PARAM_PIN - Incorrect Pin id passed. */
         if(Pin >= PORT_CONFIGURED_CHANNELS){
             Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+            return ;
         }else{
             /* nothing to do */
         }
 
         /* PORT_E_DIRECTION_UNCHANGEABLE - Pin Not configured as direction changeable. */
-        if(Channels_Ptr->Channels[Pin].Ch_Direction_Changeable == STD_OFF){
+        if(PORT_CHANNEL_DIR_CHANGEABLE(Channels_Ptr->Channels[Pin]) == STD_OFF){
             Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+            return ;
         }else{
             /* nothing to do */
         }
 
     #endif
 
-        /* We need to declare a pointer that holds the base address of the configured port. */
-        volatile uint32* PortBaseAddress_Ptr = NULL_PTR ;
-
-        /* Now check for the port base address */
-        switch(Channels_Ptr->Channels[Pin].Port_Num){
-            case PORT_A:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTA_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_B:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTB_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_C:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTC_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_D:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTD_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_E:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTE_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_F:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTF_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            default:
-                break;
-        }
-
-        /* Now for direction adjustments
-         * 1.Check if the pins are for JTAG do nothing
-         * 2.If not change the direction
-         */
-
-        /* Checking for JTAG pins */
-        if( (Channels_Ptr->Channels[Pin].Port_Num == PORT_C) && (Channels_Ptr->Channels[Pin].Ch_Num <= 3) )
-        {
-            /* the pins are for JTAG do nothing */
-
-        }else if(Direction == PORT_PIN_OUT){
-
-            /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_DIR_REG_OFFSET) ,
-                    Channels_Ptr->Channels[Pin].Ch_Num);
+        /* The configured pin and the shadow of its port */
+        Port_ConfigChannel Channel = Channels_Ptr->Channels[Pin] ;
+        uint8 Port_Num = PORT_CHANNEL_PORT(Channel) ;
+        Port_PortShadowType* Shadow_Ptr = &Port_Shadow[Port_Num] ;
+        uint32 Interrupts_State ;
+
+        /* Now for direction adjustments (JTAG pins can not be configured , checked at compile time) ,
+         * the shadow is updated and stored with the interrupts disabled so no stale shadow is stored */
+        if(Direction == PORT_PIN_OUT){
+
+            /* Set the corresponding bit in the GPIODIR shadow to configure it as output pin then store it */
+            PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+            Shadow_Ptr->Dir |= (uint8)(1 << PORT_CHANNEL_PIN(Channel)) ;
+            Port_ShadowGeneration++ ;
+            PORT_REG(Port_BaseAddress[Port_Num] , PORT_DIR_REG_OFFSET) = Shadow_Ptr->Dir ;
+            PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
         }else if(Direction == PORT_PIN_IN){
-            /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_DIR_REG_OFFSET) ,
-                    Channels_Ptr->Channels[Pin].Ch_Num);
+            /* Clear the corresponding bit in the GPIODIR shadow to configure it as input pin then store it */
+            PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+            Shadow_Ptr->Dir &= (uint8)~(1 << PORT_CHANNEL_PIN(Channel)) ;
+            Port_ShadowGeneration++ ;
+            PORT_REG(Port_BaseAddress[Port_Num] , PORT_DIR_REG_OFFSET) = Shadow_Ptr->Dir ;
+            PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
         }else{
             /* Do Nothing */
         }
@@ -443,81 +656,30 @@ void Port_RefreshPortDirection(void){
         /* PORT_E_UNINIT - Port module not initialized.  */
         if(Port_Status == PORT_NOT_INITIALIZED){
             Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESH_PORT_DIRECTION_SID, PORT_E_UNINIT);
+            return ;
         }else{
             /* nothing to do */
         }
 
     #endif
 
-    /* Now we are going to loop through the configured pins
-     * 1. Check if the pin is JTAG pin then continue and skip it.
-     * 2. If it is not JTAG pin check if it is Direction Changeable if no refresh it
-     * if yes just don't do anything.
+    /* Now we are going to loop through the ports precomputed by Port_Init
+     * (the direction changeable pins are already out of their masks)
+     * and write the configured direction of the non changeable pins , one store per port.
      */
 
+        uint8 Index ;
+        for(Index = 0 ; Index < Port_DirRefreshNum[Port_CurrentSet] ; Index++){
 
+            const Port_DirRefreshType* Refresh_Ptr = &Port_DirRefresh[Port_CurrentSet][Index] ;
+            Port_PortShadowType* Shadow_Ptr = &Port_Shadow[Refresh_Ptr->PortIndex] ;
+            uint32 Interrupts_State ;
 
-
-        Port_PinType ArrIndex ;
-        for(ArrIndex = 0 ; ArrIndex < PORT_CONFIGURED_CHANNELS ; ArrIndex++){
-
-            /* We need to declare a pointer that holds the base address of the configured port. */
-            volatile uint32* PortBaseAddress_Ptr = NULL_PTR ;
-
-            /* Now check for the port base address */
-            switch(Channels_Ptr->Channels[ArrIndex].Port_Num){
-                case PORT_A:
-                    PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTA_BASE_ADDRESS; /* Casting to volatile uint32* */
-                    break;
-                case PORT_B:
-                    PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTB_BASE_ADDRESS; /* Casting to volatile uint32* */
-                    break;
-                case PORT_C:
-                    PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTC_BASE_ADDRESS; /* Casting to volatile uint32* */
-                    break;
-                case PORT_D:
-                    PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTD_BASE_ADDRESS; /* Casting to volatile uint32* */
-                    break;
-                case PORT_E:
-                    PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTE_BASE_ADDRESS; /* Casting to volatile uint32* */
-                    break;
-                case PORT_F:
-                    PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTF_BASE_ADDRESS; /* Casting to volatile uint32* */
-                    break;
-                default:
-                    break;
-            }
-
-            /* Now check for JTAG pins */
-            /* Checking for JTAG pins */
-            if( (Channels_Ptr->Channels[ArrIndex].Port_Num == PORT_C) && (Channels_Ptr->Channels[ArrIndex].Ch_Num <= 3) )
-            {
-                /* the pins are for JTAG just skip it */
-                continue ;
-            }else if(Channels_Ptr->Channels[ArrIndex].Ch_Direction_Changeable == STD_OFF){
-                /* Now you know that the current pin is not direction changeable
-                 * So , just check if it is output or input and refresh the direction.
-                 */
-
-                if(Channels_Ptr->Channels[ArrIndex].Ch_Direction == PORT_PIN_IN){
-
-                    /* Direction Input */
-                    /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_DIR_REG_OFFSET) ,
-                            Channels_Ptr->Channels[ArrIndex].Ch_Num);
-
-                }else if(Channels_Ptr->Channels[ArrIndex].Ch_Direction == PORT_PIN_OUT){
-
-                    /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortBaseAddress_Ptr + PORT_DIR_REG_OFFSET) ,
-                            Channels_Ptr->Channels[ArrIndex].Ch_Num);
-                }else{
-                    /* the else case just for complete syntax :p */
-                }
-            }else{
-                /* Pin direction changeable */
-                /* nothing to do here */
-            }
+            PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+            Shadow_Ptr->Dir = (uint8)((Shadow_Ptr->Dir & ~Refresh_Ptr->Mask) | Refresh_Ptr->Dir) ;
+            Port_ShadowGeneration++ ;
+            PORT_REG(Port_BaseAddress[Refresh_Ptr->PortIndex] , PORT_DIR_REG_OFFSET) = Shadow_Ptr->Dir ;
+            PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
         }
 
 }
@@ -576,14 +738,16 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
         /* PORT_E_UNINIT - Port module not initialized.  */
         if(Port_Status == PORT_NOT_INITIALIZED)
         {
-            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO_SID, PORT_E_UNINIT);
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+            return ;
         }else{
             /* nothing to do */
         }
 
         /* PORT_E_PARAM_PIN , Incorrect Port Pin ID Passed. */
         if(Pin >= PORT_CONFIGURED_CHANNELS){
-            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_PIN);
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+            return ;
 
         }else{
             /* nothing to do */
@@ -591,126 +755,297 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode){
 
         /* PORT_E_PARAM_INVALID_MODE , Port Pin Mode passed not valid */
         if(Mode > PORT_PIN_MODE_DIO){
-            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_INVALID_MODE);
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+            return ;
         }else{
             /* nothing to do */
         }
 
         /* PORT_E_MODE_UNCHANGEABLE , API called when the mode is unchangeable */
-        if(Channels_Ptr->Channels[Pin].Ch_Mode_Changeable == STD_OFF){
-            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO_SID, PORT_E_MODE_UNCHANGEABLE);
+        if(PORT_CHANNEL_MODE_CHANGEABLE(Channels_Ptr->Channels[Pin]) == STD_OFF){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+            return ;
         }else{
             /* nothing to do */
         }
     #endif
 
-        /* We need to declare a pointer that holds the base address of the configured port. */
-        volatile uint32* PortBaseAddress_Ptr = NULL_PTR ;
+        /* Program the mode of the pin in its port shadow then store the mode registers */
+        Port_ProgramPinMode(PORT_CHANNEL_PORT(Channels_Ptr->Channels[Pin]) , PORT_CHANNEL_PIN(Channels_Ptr->Channels[Pin]) , Mode) ;
 
-        /* Now check for the port base address */
-        switch(Channels_Ptr->Channels[Pin].Port_Num){
-            case PORT_A:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTA_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_B:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTB_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_C:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTC_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_D:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTD_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_E:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTE_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            case PORT_F:
-                PortBaseAddress_Ptr = (volatile uint32* )GPIO_PORTF_BASE_ADDRESS; /* Casting to volatile uint32* */
-                break;
-            default:
-                break;
+}
+/********************************************************************/
+#if ( PORT_SET_PIN_DRIVE_API == STD_ON )
+
+void Port_SetPinDrive(Port_PinType Pin , Port_PinDriveType Drive , boolean SlewControl){
+
+    /* Expected DET errors for this function.
+     * PORT_E_UNINIT - Port module not initialized.
+     * PORT_E_PARAM_PIN - Incorrect Pin id passed.
+     * PORT_E_PARAM_INVALID_DRIVE - Invalid drive strength , or slew rate control without the 8mA drive.
+     */
+
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+
+        /* PORT_E_UNINIT - Port module not initialized.  */
+        if(Port_Status == PORT_NOT_INITIALIZED){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DRIVE_SID, PORT_E_UNINIT);
+            return ;
+        }else{
+            /* nothing to do */
         }
 
-        /* Now hold mode configuration */
+        /* PORT_E_PARAM_PIN - Incorrect Pin id passed. */
+        if(Pin >= PORT_CONFIGURED_CHANNELS){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DRIVE_SID, PORT_E_PARAM_PIN);
+            return ;
+        }else{
+            /* nothing to do */
+        }
 
-        /* First we will hold the DIO pin mode
-         * 1.Disable Analog function for the specified pin. GPIOAMSEL
-         * 2.Clear Alternative functionality for the specified pin. GPIOAFSEL
-         * 3.Clear the pin corresponding 4 PMCx bits in the GPIOPCTL
-         * 4.Enable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
+        /* PORT_E_PARAM_INVALID_DRIVE - Invalid drive strength or slew rate control. */
+        if((Drive > PORT_PIN_DRIVE_8MA) || ((SlewControl == STD_ON) && (Drive != PORT_PIN_DRIVE_8MA))){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DRIVE_SID, PORT_E_PARAM_INVALID_DRIVE);
+            return ;
+        }else{
+            /* nothing to do */
+        }
+
+    #endif
+
+        /* The configured pin , the base address and the shadow of its port */
+        Port_ConfigChannel Channel = Channels_Ptr->Channels[Pin] ;
+        uint8 Port_Num = PORT_CHANNEL_PORT(Channel) ;
+        uint32 PortBase = Port_BaseAddress[Port_Num] ;
+        Port_PortShadowType* Shadow_Ptr = &Port_Shadow[Port_Num] ;
+        uint8 PinMask = (uint8)(1 << PORT_CHANNEL_PIN(Channel)) ;
+        uint8* Drive_Ptr ;
+        uint32 Interrupts_State ;
+
+        if(Drive == PORT_PIN_DRIVE_8MA){
+            Drive_Ptr = &Shadow_Ptr->Dr8r ;
+        }else if(Drive == PORT_PIN_DRIVE_4MA){
+            Drive_Ptr = &Shadow_Ptr->Dr4r ;
+        }else{
+            Drive_Ptr = &Shadow_Ptr->Dr2r ;
+        }
+
+        /* The shadow is updated and stored without reading the registers back , with the interrupts
+         * disabled so a configuration switch never stores a half updated shadow.
+         * Only one of the GPIODRxR shadows keeps the pin bit , storing the selected register clears the bit
+         * in the other two , then the slew rate control is stored once the drive is selected.
          */
-        if(Mode == PORT_PIN_MODE_DIO){
+        PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+        Shadow_Ptr->Dr2r &= (uint8)~PinMask ;
+        Shadow_Ptr->Dr4r &= (uint8)~PinMask ;
+        Shadow_Ptr->Dr8r &= (uint8)~PinMask ;
+        *Drive_Ptr |= PinMask ;
+        if(SlewControl == STD_ON){
+            Shadow_Ptr->Slr |= PinMask ;
+        }else{
+            Shadow_Ptr->Slr &= (uint8)~PinMask ;
+        }
+        Port_ShadowGeneration++ ;
+        PORT_REG(PortBase , Port_DriveRegOffset[Drive]) = *Drive_Ptr ;
+        PORT_REG(PortBase , PORT_SLEW_RATE_REG_OFFSET)  = Shadow_Ptr->Slr ;
+        PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
+}
 
-            /* Step 1 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ,
-                     Channels_Ptr->Channels[Pin].Ch_Num);
+#endif
+/********************************************************************/
+void Port_SetPinNotification(Port_PinType Pin , Port_NotificationType Notification){
 
-            /* Step 2 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ALT_FUNC_REG_OFFSET) ,
-                      Channels_Ptr->Channels[Pin].Ch_Num);
+    /* Expected DET errors for this function.
+     * PORT_E_UNINIT - Port module not initialized.
+     * PORT_E_PARAM_PIN - Incorrect Pin id passed.
+     */
 
-            /* the register value anded with zeros at 4 * Ch_Num  (Step 3) */
-            *(volatile uint32*)((volatile uint8 *)PortBaseAddress_Ptr + PORT_CTL_REG_OFFSET) &=
-                    ~(0x0000000F << (Channels_Ptr->Channels[Pin].Ch_Num * 4)) ;
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
-            /* Step 4 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) ,
-                    Channels_Ptr->Channels[Pin].Ch_Num);
-        }else if(Mode == PORT_PIN_MODE_ADC){
+        /* PORT_E_UNINIT - Port module not initialized.  */
+        if(Port_Status == PORT_NOT_INITIALIZED){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_NOTIFICATION_SID, PORT_E_UNINIT);
+            return ;
+        }else{
+            /* nothing to do */
+        }
+
+        /* PORT_E_PARAM_PIN - Incorrect Pin id passed. */
+        if(Pin >= PORT_CONFIGURED_CHANNELS){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_NOTIFICATION_SID, PORT_E_PARAM_PIN);
+            return ;
+        }else{
+            /* nothing to do */
+        }
 
-            /* ADC pin mode
-             * 1.Enable Analog function for the specified pin. GPIOAMSEL
-             * 2.Clear Alternative functionality for the specified pin. GPIOAFSEL
-             * 3.Clear the pin corresponding 4 PMCx bits in the GPIOPCTL
-             * 4.Disable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
-             */
-
-            /* Step 1 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ,
-                     Channels_Ptr->Channels[Pin].Ch_Num);
-
-            /* Step 2 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ALT_FUNC_REG_OFFSET) ,
-                      Channels_Ptr->Channels[Pin].Ch_Num);
-
-            /* the register value anded with zeros at 4 * Ch_Num  (Step 3) */
-            *(volatile uint32*)((volatile uint8 *)PortBaseAddress_Ptr + PORT_CTL_REG_OFFSET) &=
-                    ~(0x0000000F << (Channels_Ptr->Channels[Pin].Ch_Num * 4)) ;
-
-            /* Step 4 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) ,
-                    Channels_Ptr->Channels[Pin].Ch_Num);
-        }else if(((Mode >= PORT_PIN_MODE_ALT_1) && (Mode <= PORT_PIN_MODE_ALT_9)) ||
-                ((Mode >= PORT_PIN_MODE_ALT_14) && (Mode <= PORT_PIN_MODE_ALT_15))){
-
-            /* Here we are dealing with alternative functions for pins */
-            /* Alternative pin mode
-             * 1.Disable Analog function for the specified pin. GPIOAMSEL
-             * 2.Set Alternative functionality for the specified pin. GPIOAFSEL
-             * 3.Set the pin corresponding 4 PMCx bits in the GPIOPCTL with the alternative functionality value.
-             * 4.Enable the corresponding I/O pins by writing one to the corresponding position in GPIODEN.
-             */
-            /* Step 1 */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ,
-                     Channels_Ptr->Channels[Pin].Ch_Num);
-
-            /* Step 2 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_ALT_FUNC_REG_OFFSET) ,
-                      Channels_Ptr->Channels[Pin].Ch_Num);
-
-            /* the register value OR'ed with alternative functionality value at shifted position
-             * to the left with value equal to (4 * Ch_Num)  (Step 3) */
-            *(volatile uint32*)((volatile uint8 *)PortBaseAddress_Ptr + PORT_CTL_REG_OFFSET) |=
-                    (Mode & 0x0000000F << (Channels_Ptr->Channels[Pin].Ch_Num * 4)) ;
-
-            /* Step 4 */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortBaseAddress_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) ,
-                    Channels_Ptr->Channels[Pin].Ch_Num);
+    #endif
+
+        /* The ISR looks the notification up by the hardware port and pin number of the channel */
+        Port_PinNotification[PORT_CHANNEL_PORT(Channels_Ptr->Channels[Pin])][PORT_CHANNEL_PIN(Channels_Ptr->Channels[Pin])] = Notification ;
+}
+
+/********************************************************************/
 
+/* Description: Common body of the GPIO port ISRs.
+ *  The masked interrupt status is read once and acknowledged , then the notification of every pending
+ *  pin is called , the highest pin first , each pin found with one CLZ instead of scanning the 8 pins.
+ */
+LOCAL_INLINE void Port_DispatchInterrupts(uint8 PortIndex){
+
+    uint32 PortBase = Port_BaseAddress[PortIndex] ;
+    uint32 Pending = PORT_REG(PortBase , PORT_INT_MASKED_STATUS_REG_OFFSET) ;
+
+    PORT_REG(PortBase , PORT_INT_CLEAR_REG_OFFSET) = Pending ;
+
+    while(Pending != 0){
+        uint8 PinNum = (uint8)(31 - COUNT_LEADING_ZEROS(Pending)) ;
+
+        Pending &= ~((uint32)1 << PinNum) ;
+        if(Port_PinNotification[PortIndex][PinNum] != NULL_PTR){
+            Port_PinNotification[PortIndex][PinNum]() ;
+        }
+    }
+}
+
+/************************************************************************************
+* Service Name: GPIOPortA_Handler .. GPIOPortF_Handler
+* Description: GPIO ports ISRs
+************************************************************************************/
+void GPIOPortA_Handler(void){ Port_DispatchInterrupts(PORT_A) ; }
+void GPIOPortB_Handler(void){ Port_DispatchInterrupts(PORT_B) ; }
+void GPIOPortC_Handler(void){ Port_DispatchInterrupts(PORT_C) ; }
+void GPIOPortD_Handler(void){ Port_DispatchInterrupts(PORT_D) ; }
+void GPIOPortE_Handler(void){ Port_DispatchInterrupts(PORT_E) ; }
+void GPIOPortF_Handler(void){ Port_DispatchInterrupts(PORT_F) ; }
+
+/********************************************************************/
+#if ( PORT_CONFIG_SWITCH_API == STD_ON )
+
+void Port_SwitchConfiguration(Port_ConfigSetType ConfigSet){
+
+    Port_PortDeltaType Deltas[PORT_NUMBER_OF_PORTS] ;
+    uint8 PortIndex ;
+    uint32 Interrupts_State ;
+    uint32 Generation ;
+
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* PORT_E_UNINIT - Port module not initialized.  */
+        if(Port_Status == PORT_NOT_INITIALIZED){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIGURATION_SID, PORT_E_UNINIT);
+            return ;
         }else{
-            /* do nothing */
+            /* nothing to do */
+        }
+
+    #endif
+
+    /* Not one of the configuration sets , or its image failed the checks of Port_Init */
+    if((ConfigSet >= PORT_CONFIGURATION_SETS) || !(Port_ValidSets & (1<<ConfigSet))){
+
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIGURATION_SID, PORT_E_PARAM_CONFIG);
+    #endif
+        return ;
+    }
+
+    /* The register values are computed from the port shadows with the interrupts enabled , then only the
+     * changed registers are stored with the interrupts disabled , so no task or ISR sees the pins half
+     * reconfigured. A shadow updated by a preempting task or ISR meanwhile changes the generation ,
+     * then the values are computed again from RAM before the stores so that update is not reverted.
+     */
+    Generation = Port_ShadowGeneration ;
+    for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+        if(Port_UsedPorts & (1<<PortIndex)){
+            Port_ComputeDelta(PortIndex , &Port_SetImages[ConfigSet][PortIndex] , &Deltas[PortIndex]) ;
         }
+    }
 
+    PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+    if(Generation != Port_ShadowGeneration){
+        for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+            if(Port_UsedPorts & (1<<PortIndex)){
+                Port_ComputeDelta(PortIndex , &Port_SetImages[ConfigSet][PortIndex] , &Deltas[PortIndex]) ;
+            }
+        }
+    }
+    for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+        if(Port_UsedPorts & (1<<PortIndex)){
+            Port_ApplyDelta(PortIndex , &Deltas[PortIndex]) ;
+        }
+    }
+    Channels_Ptr    = &Port_ConfigurationSets[ConfigSet] ;
+    Port_CurrentSet = ConfigSet ;
+    PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
 }
 
+#endif
+/********************************************************************/
+#if ( PORT_REGISTERS_VERIFY_API == STD_ON )
+
+Std_ReturnType Port_VerifyRegisters(void){
+
+    Std_ReturnType Result = E_OK ;
+    uint8 PortIndex ;
 
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* PORT_E_UNINIT - Port module not initialized.  */
+        if(Port_Status == PORT_NOT_INITIALIZED){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_VERIFY_REGISTERS_SID, PORT_E_UNINIT);
+            return E_NOT_OK ;
+        }else{
+            /* nothing to do */
+        }
+    #endif
+
+    for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+
+        uint32 PortBase = Port_BaseAddress[PortIndex] ;
+        const Port_PortShadowType* Shadow_Ptr = &Port_Shadow[PortIndex] ;
+
+        if(!(Port_UsedPorts & (1<<PortIndex))){
+            continue ;
+        }
+
+        if( ((uint8)PORT_REG(PortBase , PORT_DIR_REG_OFFSET)             != Shadow_Ptr->Dir)
+         || ((uint8)PORT_REG(PortBase , PORT_DIGITAL_ENABLE_REG_OFFSET)  != Shadow_Ptr->Den)
+         || ((uint8)PORT_REG(PortBase , PORT_ALT_FUNC_REG_OFFSET)        != Shadow_Ptr->Afsel)
+         || ((uint8)PORT_REG(PortBase , PORT_ANALOG_MODE_SEL_REG_OFFSET) != Shadow_Ptr->Amsel)
+         || (PORT_REG(PortBase , PORT_CTL_REG_OFFSET)                    != Shadow_Ptr->Pctl) ){
+            Result = E_NOT_OK ;
+        }else{
+            /* registers match their shadow */
+        }
+    }
+
+    return Result ;
+}
+/********************************************************************/
+void Port_ResyncRegisters(void){
+
+    uint8 PortIndex ;
+    uint32 Interrupts_State ;
+
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* PORT_E_UNINIT - Port module not initialized.  */
+        if(Port_Status == PORT_NOT_INITIALIZED){
+            Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_RESYNC_REGISTERS_SID, PORT_E_UNINIT);
+            return ;
+        }else{
+            /* nothing to do */
+        }
+    #endif
+
+    for(PortIndex = 0 ; PortIndex < PORT_NUMBER_OF_PORTS ; PortIndex++){
+
+        if(!(Port_UsedPorts & (1<<PortIndex))){
+            continue ;
+        }
+
+        PORT_ENTER_CRITICAL_SECTION(Interrupts_State) ;
+        Port_StoreModeRegisters(PortIndex) ;
+        PORT_REG(Port_BaseAddress[PortIndex] , PORT_DIR_REG_OFFSET) = Port_Shadow[PortIndex].Dir ;
+        PORT_EXIT_CRITICAL_SECTION(Interrupts_State) ;
+    }
+}
+
+#endif
@@ -71,6 +71,7 @@
 
 /* Non AUTOSAR Files */
 #include "Common_Macros.h"
+#include "Config_Image.h"
 
 /*******************************************************************************
  *                           API Service Id Macros                             *
@@ -91,6 +92,21 @@
 /* Service ID for Setting a Pin Mode in a specific port */
 #define PORT_SET_PIN_MODE_SID               (uint8)0x04
 
+/* Service ID for Switching to another configuration set */
+#define PORT_SWITCH_CONFIGURATION_SID       (uint8)0x12
+
+/* Service ID for Setting a Pin drive strength and slew rate control */
+#define PORT_SET_PIN_DRIVE_SID              (uint8)0x13
+
+/* Service ID for Setting a Pin interrupt notification */
+#define PORT_SET_PIN_NOTIFICATION_SID       (uint8)0x14
+
+/* Service ID for Verifying the port registers against their shadow */
+#define PORT_VERIFY_REGISTERS_SID           (uint8)0x10
+
+/* Service ID for Rewriting the port registers from their shadow */
+#define PORT_RESYNC_REGISTERS_SID           (uint8)0x11
+
 
 /*******************************************************************************
  *                      DET Error Codes                                        *
@@ -117,17 +133,34 @@
 /* DET code for APIs called with a Null Pointer */
 #define PORT_E_PARAM_POINTER                (uint8)0x10
 
+/* DET code for API Port_SetPinDrive called with an invalid drive strength or slew rate control */
+#define PORT_E_PARAM_INVALID_DRIVE          (uint8)0x11
+
 /*******************************************************************************
  *                              Module Definitions                             *
  *******************************************************************************/
 
 /* GPIO Registers base addresses */
+#if (PORT_GPIO_AHB_ACCESS == STD_ON)
+/* Advanced High-performance Bus apertures */
+#define GPIO_PORTA_BASE_ADDRESS           0x40058000
+#define GPIO_PORTB_BASE_ADDRESS           0x40059000
+#define GPIO_PORTC_BASE_ADDRESS           0x4005A000
+#define GPIO_PORTD_BASE_ADDRESS           0x4005B000
+#define GPIO_PORTE_BASE_ADDRESS           0x4005C000
+#define GPIO_PORTF_BASE_ADDRESS           0x4005D000
+#else
+/* Advanced Peripheral Bus apertures */
 #define GPIO_PORTA_BASE_ADDRESS           0x40004000
 #define GPIO_PORTB_BASE_ADDRESS           0x40005000
 #define GPIO_PORTC_BASE_ADDRESS           0x40006000
 #define GPIO_PORTD_BASE_ADDRESS           0x40007000
 #define GPIO_PORTE_BASE_ADDRESS           0x40024000
 #define GPIO_PORTF_BASE_ADDRESS           0x40025000
+#endif
+
+/* Number of the GPIO ports PORT_A .. PORT_F */
+#define PORT_NUMBER_OF_PORTS              (6U)
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
@@ -140,6 +173,20 @@
 #define PORT_COMMIT_REG_OFFSET            0x524
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
+#define PORT_DRIVE_2MA_REG_OFFSET         0x500
+#define PORT_DRIVE_4MA_REG_OFFSET         0x504
+#define PORT_DRIVE_8MA_REG_OFFSET         0x508
+#define PORT_SLEW_RATE_REG_OFFSET         0x518
+#define PORT_INT_SENSE_REG_OFFSET         0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    0x408
+#define PORT_INT_EVENT_REG_OFFSET         0x40C
+#define PORT_INT_MASK_REG_OFFSET          0x410
+#define PORT_INT_RAW_STATUS_REG_OFFSET    0x414
+#define PORT_INT_MASKED_STATUS_REG_OFFSET 0x418
+#define PORT_INT_CLEAR_REG_OFFSET         0x41C
+
+/* GPIODATA offset where only the pins set in MASK are affected by a store (address bits [9:2]) */
+#define PORT_DATA_MASKED_REG_OFFSET(MASK) ((uint32)(MASK) << 2)
 
 /*******************************************************************************
  *                              Module Data Types                              *
@@ -151,6 +198,9 @@ typedef uint8 Port_PinType;
 /* Description: uint8 to hold PIN mode type */
 typedef uint8 Port_PinModeType;
 
+/* Description: uint8 to hold the index of a configuration set in Port_ConfigurationSets */
+typedef uint8 Port_ConfigSetType;
+
 
 /* Description: Enum to hold PIN direction */
 typedef enum
@@ -170,38 +220,161 @@ typedef enum{
     PORT_PIN_LEVEL_LOW,PORT_PIN_LEVEL_HIGH
 }Port_PinInitialValue;
 
-/* Description: Structure to configure each individual PIN:
+/* Description: Enum to hold PIN output drive strength (GPIODR2R , GPIODR4R and GPIODR8R) */
+typedef enum
+{
+    PORT_PIN_DRIVE_2MA,PORT_PIN_DRIVE_4MA,PORT_PIN_DRIVE_8MA
+}Port_PinDriveType;
+
+/* Description: Enum to hold PIN interrupt trigger (GPIOIS , GPIOIBE , GPIOIEV and GPIOIM) */
+typedef enum
+{
+    PORT_PIN_INTERRUPT_NONE,PORT_PIN_INTERRUPT_FALLING_EDGE,PORT_PIN_INTERRUPT_RISING_EDGE,
+    PORT_PIN_INTERRUPT_BOTH_EDGES,PORT_PIN_INTERRUPT_LOW_LEVEL,PORT_PIN_INTERRUPT_HIGH_LEVEL
+}Port_PinInterruptType;
+
+/* Description: Pointer to the function notified by the GPIO port ISR when the pin interrupt fires */
+typedef void (*Port_NotificationType)(void);
+
+/* Description: uint32 word packing the configuration of each individual PIN , built by PORT_CHANNEL_ENCODE:
  *
- *	1. the PORT Which the pin belongs to. 0, 1, 2, 3, 4 or 5
- *	2. the number of the pin in the PORT.
- *	3. Initial Value of the pin ( this port pin configuration is mandatory when the port pin is used for DIO. )
- *	4. the direction of pin --> INPUT or OUTPUT
- *  5. Pin Mode.
- *  6. the internal resistor --> Disable, Pull up or Pull down.
- *  7. Boolean Flag to tell either this pin direction is changeable or not.
- *  8. Boolean Flag to tell either this pin mode is changeable or not.
+ *  bits [2:0]   the number of the pin in the PORT.
+ *  bits [5:3]   the PORT Which the pin belongs to. 0, 1, 2, 3, 4 or 5 (bits [5:0] are the PIN_ID shared with Dio)
+ *  bits [10:6]  Pin Mode.
+ *  bit  11      the direction of pin --> INPUT or OUTPUT
+ *  bit  12      Initial Value of the pin ( this port pin configuration is mandatory when the port pin is used for DIO. )
+ *  bits [14:13] the internal resistor --> Disable, Pull up or Pull down.
+ *  bits [16:15] Output drive strength --> 2mA, 4mA or 8mA.
+ *  bit  17      Slew rate control (GPIOSLR) , only available with the 8mA drive.
+ *  bits [20:18] Interrupt trigger --> None, Falling edge, Rising edge, Both edges, Low level or High level.
+ *  bit  21      Boolean Flag to tell either this pin direction is changeable or not.
+ *  bit  22      Boolean Flag to tell either this pin mode is changeable or not.
  *
  */
+typedef uint32 Port_ConfigChannel;
 
-typedef struct 
+/* Description: Post-build configuration image of one configuration set: the image header followed by
+ *              the words of the configured pins , the CRC of the header covers the Channels array only.
+ */
+typedef struct Port_ConfigType
 {
+    Config_ImageHeaderType Header ;
+    Port_ConfigChannel Channels[PORT_CONFIGURED_CHANNELS] ;
+} Port_ConfigType;
 
-    uint8                   Port_Num;
-    Port_PinType            Ch_Num;
-    Port_PinInitialValue    Ch_Initial_value;
-    Port_PinDirectionType   Ch_Direction;
-    Port_PinModeType        Ch_Mode;
-    Port_InternalResistor   Resistor;
-    boolean                 Ch_Direction_Changeable;
-    boolean                 Ch_Mode_Changeable;
+/* Length of the payload of a configuration set image */
+#define PORT_CONFIG_IMAGE_LENGTH        (PORT_CONFIGURED_CHANNELS * 4U)
 
+/* Description: Structure to hold the register image of one GPIO port folded from the configured pins,
+ *              so Port_Init writes each register of the port only once.
+ *
+ *  1. Masks of the pins whose mode, direction, initial level and internal resistor are configured.
+ *  2. The values to be written to those pins in GPIOAMSEL, GPIOAFSEL, GPIODEN, GPIOPCTL,
+ *     GPIODIR, GPIODATA, GPIOPUR, GPIOPDR, GPIODR2R, GPIODR4R, GPIODR8R, GPIOSLR,
+ *     GPIOIS, GPIOIBE, GPIOIEV and GPIOIM.
+ *  3. Mask of the locked pins (PD7 & PF0) that need the GPIOLOCK / GPIOCR commit sequence.
+ *  4. Mask of the pins whose direction is not changeable , refreshed by Port_RefreshPortDirection.
+ */
+typedef struct
+{
+    uint8   Mode_Mask;
+    uint8   Dir_Mask;
+    uint8   Refresh_Mask;
+    uint8   Data_Mask;
+    uint8   Pull_Mask;
+    uint8   Commit_Mask;
+
+    uint8   Amsel;
+    uint8   Afsel;
+    uint8   Den;
+    uint8   Dir;
+    uint8   Data;
+    uint8   Pur;
+    uint8   Pdr;
+    uint8   Dr2r;
+    uint8   Dr4r;
+    uint8   Dr8r;
+    uint8   Slr;
+    uint8   Is;
+    uint8   Ibe;
+    uint8   Iev;
+    uint8   Im;
+    uint32  Pctl_Mask;
+    uint32  Pctl;
+
+}Port_PortRegsType;
+
+/* Description: Structure to hold the RAM shadow of the mode , direction , drive strength , slew rate ,
+ *              internal resistors and interrupt registers of one GPIO port.
+ *              It is loaded from the port once by Port_Init , then every modification is done on the
+ *              shadow first and stored to the register without reading it back.
+ */
+typedef struct
+{
+    uint8   Dir;
+    uint8   Den;
+    uint8   Afsel;
+    uint8   Amsel;
+    uint32  Pctl;
+    uint8   Dr2r;
+    uint8   Dr4r;
+    uint8   Dr8r;
+    uint8   Slr;
+    uint8   Pur;
+    uint8   Pdr;
+    uint8   Is;
+    uint8   Ibe;
+    uint8   Iev;
+    uint8   Im;
+
+}Port_PortShadowType;
+
+/* Description: Structure to hold the direction refresh of one GPIO port, precomputed by Port_Init:
+ *
+ *  1. The port index.
+ *  2. Mask of the pins whose direction is not changeable.
+ *  3. The configured direction of those pins.
+ */
+typedef struct
+{
+    uint8   PortIndex;
+    uint8   Mask;
+    uint8   Dir;
 
-}Port_ConfigChannel;
+}Port_DirRefreshType;
 
-typedef struct Port_ConfigChannel
+/* Description: Structure to hold the register values of one GPIO port computed before a configuration
+ *              switch , so only stores are left to be done inside the critical section:
+ *
+ *  1. Mask of the registers to be stored (PORT_DELTA_xxx bits in Port.c).
+ *  2. The values of GPIOAMSEL , GPIOAFSEL , GPIODEN , GPIOPCTL , GPIODIR , GPIOPUR , GPIOPDR ,
+ *     GPIODR2R , GPIODR4R , GPIODR8R , GPIOSLR , GPIOIS , GPIOIBE , GPIOIEV and GPIOIM.
+ *  3. The initial levels and the mask of the pins turning into outputs.
+ *  4. The mask of the pins whose interrupt is reconfigured.
+ */
+typedef struct
 {
-    Port_ConfigChannel Channels[PORT_CONFIGURED_CHANNELS] ;
-} Port_ConfigType;
+    uint16  Changed;
+    uint8   Amsel;
+    uint8   Afsel;
+    uint8   Den;
+    uint8   Dir;
+    uint8   Data_Mask;
+    uint8   Data;
+    uint8   Pur;
+    uint8   Pdr;
+    uint8   Dr2r;
+    uint8   Dr4r;
+    uint8   Dr8r;
+    uint8   Slr;
+    uint8   Int_Mask;
+    uint8   Is;
+    uint8   Ibe;
+    uint8   Iev;
+    uint8   Im;
+    uint32  Pctl;
+
+}Port_PortDeltaType;
 
 
 /*******************************************************************************
@@ -242,6 +415,45 @@ typedef struct Port_ConfigChannel
 #define PORT_PIN_MODE_ALT_15    (uint8)15
 #define PORT_PIN_MODE_DIO       (uint8)16
 
+/* Position of each field in the Port_ConfigChannel word */
+#define PORT_CHANNEL_PIN_ID_SHIFT           0U
+#define PORT_CHANNEL_MODE_SHIFT             6U
+#define PORT_CHANNEL_DIRECTION_SHIFT        11U
+#define PORT_CHANNEL_LEVEL_SHIFT            12U
+#define PORT_CHANNEL_RESISTOR_SHIFT         13U
+#define PORT_CHANNEL_DRIVE_SHIFT            15U
+#define PORT_CHANNEL_SLEW_SHIFT             17U
+#define PORT_CHANNEL_INTERRUPT_SHIFT        18U
+#define PORT_CHANNEL_DIR_CHANGEABLE_SHIFT   21U
+#define PORT_CHANNEL_MODE_CHANGEABLE_SHIFT  22U
+
+/* Pack the configuration of one pin into its Port_ConfigChannel word ,
+ * the field ranges are checked at compile time by PORT_CHANNEL_IS_VALID */
+#define PORT_CHANNEL_ENCODE(PORT,PIN,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    ( ((uint32)PIN_ID(PORT,PIN)    << PORT_CHANNEL_PIN_ID_SHIFT) \
+    | ((uint32)(MODE)              << PORT_CHANNEL_MODE_SHIFT) \
+    | ((uint32)(DIR)               << PORT_CHANNEL_DIRECTION_SHIFT) \
+    | ((uint32)(INIT)              << PORT_CHANNEL_LEVEL_SHIFT) \
+    | ((uint32)(RES)               << PORT_CHANNEL_RESISTOR_SHIFT) \
+    | ((uint32)(DRIVE)             << PORT_CHANNEL_DRIVE_SHIFT) \
+    | ((uint32)(SLEW)              << PORT_CHANNEL_SLEW_SHIFT) \
+    | ((uint32)(INT)               << PORT_CHANNEL_INTERRUPT_SHIFT) \
+    | ((uint32)(DIR_CHG)           << PORT_CHANNEL_DIR_CHANGEABLE_SHIFT) \
+    | ((uint32)(MODE_CHG)          << PORT_CHANNEL_MODE_CHANGEABLE_SHIFT) )
+
+/* Read one field of a Port_ConfigChannel word */
+#define PORT_CHANNEL_PORT(CH)               ((uint8)PIN_ID_PORT((CH) >> PORT_CHANNEL_PIN_ID_SHIFT))
+#define PORT_CHANNEL_PIN(CH)                ((Port_PinType)PIN_ID_PIN((CH) >> PORT_CHANNEL_PIN_ID_SHIFT))
+#define PORT_CHANNEL_MODE(CH)               ((Port_PinModeType)(((CH) >> PORT_CHANNEL_MODE_SHIFT) & 0x1FU))
+#define PORT_CHANNEL_DIRECTION(CH)          ((Port_PinDirectionType)(((CH) >> PORT_CHANNEL_DIRECTION_SHIFT) & 0x01U))
+#define PORT_CHANNEL_LEVEL(CH)              ((Port_PinInitialValue)(((CH) >> PORT_CHANNEL_LEVEL_SHIFT) & 0x01U))
+#define PORT_CHANNEL_RESISTOR(CH)           ((Port_InternalResistor)(((CH) >> PORT_CHANNEL_RESISTOR_SHIFT) & 0x03U))
+#define PORT_CHANNEL_DRIVE(CH)              ((Port_PinDriveType)(((CH) >> PORT_CHANNEL_DRIVE_SHIFT) & 0x03U))
+#define PORT_CHANNEL_SLEW(CH)               ((boolean)(((CH) >> PORT_CHANNEL_SLEW_SHIFT) & 0x01U))
+#define PORT_CHANNEL_INTERRUPT(CH)          ((Port_PinInterruptType)(((CH) >> PORT_CHANNEL_INTERRUPT_SHIFT) & 0x07U))
+#define PORT_CHANNEL_DIR_CHANGEABLE(CH)     ((boolean)(((CH) >> PORT_CHANNEL_DIR_CHANGEABLE_SHIFT) & 0x01U))
+#define PORT_CHANNEL_MODE_CHANGEABLE(CH)    ((boolean)(((CH) >> PORT_CHANNEL_MODE_CHANGEABLE_SHIFT) & 0x01U))
+
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
@@ -252,13 +464,15 @@ typedef struct Port_ConfigChannel
 * Service ID: 0x00
 * Sync/Async: Synchronous
 * Reentrancy: Non Reentrant
-* Parameters (in): ConfigPtr (Pointer to configuration set.)
+* Parameters (in): ConfigPtr (Pointer to configuration set , one of Port_ConfigurationSets.)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
 * Description: Initializes the Port Driver module.
+*              The image of every configuration set is checked first (header and CRC) ,
+*              the module stays not initialized if the image of ConfigPtr fails.
 ************************************************************************************/
-void Port_Init(Port_ConfigType* ConfigPtr);
+void Port_Init(const Port_ConfigType* ConfigPtr);
 
 
 
@@ -332,7 +546,171 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 
 
-/* Configuration Structure  */
-extern const Port_ConfigType Port_Configuration ;
+/************************************************************************************
+* Service Name: Port_SetPinDrive
+* Service ID: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in):
+*               -Pin , Port Pin ID number.
+*               -Drive , New output drive strength of the pin (2mA , 4mA or 8mA).
+*               -SlewControl , STD_ON to enable the slew rate control , only valid with the 8mA drive.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the port pin drive strength and slew rate control.
+************************************************************************************/
+#if ( PORT_SET_PIN_DRIVE_API == STD_ON )
+
+void Port_SetPinDrive(Port_PinType Pin , Port_PinDriveType Drive , boolean SlewControl);
+
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_SetPinNotification
+* Service ID: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in):
+*               -Pin , Port Pin ID number.
+*               -Notification , Function called by the GPIO port ISR when the pin interrupt fires ,
+*                               NULL_PTR to remove it.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Sets the notification of a pin configured with an interrupt trigger.
+*              The edge interrupts are acknowledged before the notification is called ,
+*              a level interrupt shall be removed at its source by the notification.
+************************************************************************************/
+void Port_SetPinNotification(Port_PinType Pin , Port_NotificationType Notification);
+
+
+/************************************************************************************
+* Service Name: Port_SwitchConfiguration
+* Service ID: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): ConfigSet , Index of the target configuration set in Port_ConfigurationSets.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Switches all the configured pins from the current configuration set to the target one.
+*              The register values are computed from the RAM port shadows with the interrupts enabled ,
+*              then only the changed registers are stored inside a critical section with the IRQ interrupts
+*              disabled , the values are computed again there only if a shadow was updated meanwhile.
+*              The pins that stay outputs keep their level , the pins turning into outputs get the
+*              initial level of the target set , reported to PORT_SWITCH_LEVELS_CALLOUT in the same critical section.
+*              PRIMASK is restored on exit , so it may be called with the IRQ interrupts disabled.
+*              A set whose image failed the checks of Port_Init is rejected (PORT_E_PARAM_CONFIG).
+************************************************************************************/
+#if ( PORT_CONFIG_SWITCH_API == STD_ON )
+
+void Port_SwitchConfiguration(Port_ConfigSetType ConfigSet);
+
+#endif
+
+
+/************************************************************************************
+* Service Name: Port_VerifyRegisters
+* Service ID: 0x10
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType , E_OK if the GPIODIR , GPIODEN , GPIOAFSEL , GPIOAMSEL and GPIOPCTL
+*               registers of all the configured ports match their shadow , E_NOT_OK otherwise.
+* Description: Detects corrupted port registers.
+************************************************************************************/
+#if ( PORT_REGISTERS_VERIFY_API == STD_ON )
+
+Std_ReturnType Port_VerifyRegisters(void);
+
+
+/************************************************************************************
+* Service Name: Port_ResyncRegisters
+* Service ID: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Rewrites the GPIODIR , GPIODEN , GPIOAFSEL , GPIOAMSEL and GPIOPCTL registers
+*              of all the configured ports from their shadow.
+************************************************************************************/
+void Port_ResyncRegisters(void);
+
+#endif
+
+
+/* Configuration Sets , all of them configure the same channels in the same order.
+ * They are placed in the .port_config flash section , one fixed size slot per set , so a set is selected by
+ * its index and the images built by tools/config_image.py can replace them without rebuilding. */
+extern const Port_ConfigType Port_ConfigurationSets[PORT_CONFIGURATION_SETS] ;
+
+/* Configuration set selected at start up */
+#define Port_Configuration      (Port_ConfigurationSets[PortConf_ACTIVE_CONFIG_SET_ID])
+
+#if (PORT_INIT_PROFILING == STD_ON)
+/* Core clock cycles Port_Init spent enabling the GPIO clocks and waiting for the ports to be ready */
+extern uint32 Port_InitClockCycles ;
+#endif
+
+/*******************************************************************************
+ *                  Compile Time Configuration Checks Helpers                  *
+ *******************************************************************************/
+
+/* Bit of a pin in a 64-bit key holding 8 bits per port , PORT_A in bits 0..7 */
+#define PORT_PIN_KEY(PORT,PIN)          ((uint64)1 << ((((PORT) * 8U) + (PIN)) & 63U))
+
+/* Port and pin pair exists on the TM4C123GH6PM: PORT A,B,C,D have pins 0-7 , PORT E 0-5 and PORT F 0-4 */
+#define PORT_PIN_EXISTS(PORT,PIN)       ((((PORT) <= PORT_D) && ((PIN) <= PORT_PIN_7)) \
+                                      || (((PORT) == PORT_E) && ((PIN) <= PORT_PIN_5)) \
+                                      || (((PORT) == PORT_F) && ((PIN) <= PORT_PIN_4)))
+
+/* JTAG/SWD pins PC[0:3] shall never be configured */
+#define PORT_PIN_IS_JTAG(PORT,PIN)      (((PORT) == PORT_C) && ((PIN) <= PORT_PIN_3))
+
+/* Modes supported by Port_Init */
+#define PORT_MODE_IS_VALID(MODE)        (((MODE) == PORT_PIN_MODE_DIO) || ((MODE) == PORT_PIN_MODE_ADC) \
+                                      || (((MODE) >= PORT_PIN_MODE_ALT_1)  && ((MODE) <= PORT_PIN_MODE_ALT_9)) \
+                                      || (((MODE) >= PORT_PIN_MODE_ALT_14) && ((MODE) <= PORT_PIN_MODE_ALT_15)))
+
+/* Row of a configuration set in Port_Cfg.h is a valid pin configuration */
+#define PORT_CHANNEL_IS_VALID(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    && PORT_PIN_EXISTS(PortConf_##NAME##_PORT_NUM , PortConf_##NAME##_CHANNEL_NUM) \
+    && !PORT_PIN_IS_JTAG(PortConf_##NAME##_PORT_NUM , PortConf_##NAME##_CHANNEL_NUM) \
+    && PORT_MODE_IS_VALID(MODE) \
+    && (((DIR) == PORT_PIN_IN) || ((DIR) == PORT_PIN_OUT)) \
+    && (((INIT) == PORT_PIN_LEVEL_LOW) || ((INIT) == PORT_PIN_LEVEL_HIGH)) \
+    && (((RES) == OFF) || ((RES) == PULL_UP) || ((RES) == PULL_DOWN)) \
+    && (((DRIVE) == PORT_PIN_DRIVE_2MA) || ((DRIVE) == PORT_PIN_DRIVE_4MA) || ((DRIVE) == PORT_PIN_DRIVE_8MA)) \
+    && (((SLEW) == STD_OFF) || ((DRIVE) == PORT_PIN_DRIVE_8MA)) \
+    && ((INT) <= PORT_PIN_INTERRUPT_HIGH_LEVEL) \
+    && (((INT) == PORT_PIN_INTERRUPT_NONE) || ((MODE) != PORT_PIN_MODE_ADC)) \
+    && (PortConf_##NAME##_CHANNEL_ID_INDEX < PORT_CONFIGURED_CHANNELS)
+
+/* Sum and OR of the pin keys and of the channel index bits of a configuration set ,
+ * they are equal only if no pin and no index is used twice */
+#define PORT_CHANNEL_KEY_SUM(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    + PORT_PIN_KEY(PortConf_##NAME##_PORT_NUM , PortConf_##NAME##_CHANNEL_NUM)
+#define PORT_CHANNEL_KEY_OR(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    | PORT_PIN_KEY(PortConf_##NAME##_PORT_NUM , PortConf_##NAME##_CHANNEL_NUM)
+#define PORT_CHANNEL_INDEX_SUM(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    + ((uint64)1 << (PortConf_##NAME##_CHANNEL_ID_INDEX & 63U))
+#define PORT_CHANNEL_INDEX_OR(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    | ((uint64)1 << (PortConf_##NAME##_CHANNEL_ID_INDEX & 63U))
+#define PORT_CHANNEL_COUNT(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    + 1U
+
+/* Keys of the pins configured in DIO mode by a configuration set */
+#define PORT_CHANNEL_DIO_KEY(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    | (((MODE) == PORT_PIN_MODE_DIO) ? PORT_PIN_KEY(PortConf_##NAME##_PORT_NUM , PortConf_##NAME##_CHANNEL_NUM) : 0U)
+
+/* Pins configured in DIO mode by all the configuration sets */
+#define PORT_SET_DIO_KEYS(SET)          & ((uint64)0 PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_DIO_KEY))
+#define PORT_DIO_PINS_KEY               (~(uint64)0 PortConf_CONFIG_SETS(PORT_SET_DIO_KEYS))
 
 #endif /* PORT_H */
@@ -37,20 +37,100 @@
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API                 (STD_ON)
 
+/* Pre-compile option for Port_VerifyRegisters and Port_ResyncRegisters APIs */
+#define PORT_REGISTERS_VERIFY_API             (STD_ON)
+
+/* Pre-compile option for Port_SetPinDrive API */
+#define PORT_SET_PIN_DRIVE_API                (STD_ON)
+
+/* Pre-compile option for Port_SwitchConfiguration API */
+#define PORT_CONFIG_SWITCH_API                (STD_ON)
+
+/*
+ * Callout called for every port whose initial output levels were stored by Port_Init or by
+ * Port_SwitchConfiguration (inside its critical section) : void Callout(uint8 PortIndex , uint8 Mask , uint8 Level).
+ * The upper layer owning the output levels records them , Port itself does not depend on it.
+ * Leave it undefined when no upper layer needs the levels.
+ */
+#define PORT_SWITCH_LEVELS_CALLOUT            Dio_PortLevelsCallout
+
+/* Number of the configuration sets in Port_PBcfg.c */
+#define PORT_CONFIGURATION_SETS               (2U)
+
+/* Configuration Set Index in the array of configuration sets in Port_PBcfg.c */
+#define PortConf_ACTIVE_CONFIG_SET_ID         (uint8)0x00   /* LEDs driven , switch pulled up */
+#define PortConf_PARKED_CONFIG_SET_ID         (uint8)0x01   /* LEDs parked as pulled down inputs */
+
+/*
+ * Pre-compile option for the GPIO bus aperture used by Port and Dio:
+ * STD_ON  - Port_Init moves every used port to the Advanced High-performance Bus (GPIOHBCTL)
+ *           and all the GPIO registers are accessed through the AHB apertures (0x40058000+),
+ *           which allow back-to-back single cycle accesses.
+ * STD_OFF - legacy Advanced Peripheral Bus apertures (0x40004000+).
+ */
+#define PORT_GPIO_AHB_ACCESS                  (STD_ON)
+
+/*
+ * Pre-compile option for the Port_Init profiling:
+ * STD_ON  - Port_Init keeps the core clock cycles of enabling the GPIO clocks and waiting for the ports
+ *           to be ready in Port_InitClockCycles , measured with Gpt_GetTimestampLow (Gpt_Init shall run first).
+ * STD_OFF - No measurement.
+ */
+#define PORT_INIT_PROFILING                   (STD_OFF)
+
 /* Number of Configured channels */
-#define PORT_CONFIGURED_CHANNELS              (2U)
+#define PORT_CONFIGURED_CHANNELS              (4U)
 
 /* Channel Index in the array of structures in Port_PBcfg.c */
 #define PortConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
 #define PortConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
+#define PortConf_LED2_CHANNEL_ID_INDEX        (uint8)0x02
+#define PortConf_LED3_CHANNEL_ID_INDEX        (uint8)0x03
 
 
 /* PIN Configured Port ID's  */
 #define PortConf_LED1_PORT_NUM                (uint8)5 /* PORTF */
 #define PortConf_SW1_PORT_NUM                 (uint8)5 /* PORTF */
+#define PortConf_LED2_PORT_NUM                (uint8)5 /* PORTF */
+#define PortConf_LED3_PORT_NUM                (uint8)5 /* PORTF */
 
 /* PORT Configured Channel ID's */
 #define PortConf_LED1_CHANNEL_NUM             (Port_PinType)1 /* Pin 1 in PORTF */
 #define PortConf_SW1_CHANNEL_NUM              (Port_PinType)4 /* Pin 4 in PORTF */
+#define PortConf_LED2_CHANNEL_NUM             (Port_PinType)2 /* Pin 2 in PORTF */
+#define PortConf_LED3_CHANNEL_NUM             (Port_PinType)3 /* Pin 3 in PORTF */
+
+/*
+ * Pins of every configuration set , expanded by Port_PBcfg.c into Port_ConfigurationSets and by the
+ * compile time configuration checks in Port_PBcfg.c and Dio_PBcfg.c:
+ * CHANNEL( Name , Initial value , Direction , Mode , Internal resistor , Drive strength , Slew rate control ,
+ *          Interrupt , Direction changeable , Mode changeable )
+ * Name selects PortConf_<Name>_CHANNEL_ID_INDEX , PortConf_<Name>_PORT_NUM and PortConf_<Name>_CHANNEL_NUM.
+ * The slew rate control can only be enabled with the 8mA drive , and the interrupt only on digital pins.
+ */
+#define PortConf_ACTIVE_CONFIG_SET(CHANNEL) \
+    CHANNEL( LED1 , PORT_PIN_LEVEL_LOW , PORT_PIN_OUT , PORT_PIN_MODE_DIO , OFF       , PORT_PIN_DRIVE_8MA , STD_ON  , PORT_PIN_INTERRUPT_NONE       , STD_ON , STD_ON ) \
+    CHANNEL( SW1  , PORT_PIN_LEVEL_LOW , PORT_PIN_IN  , PORT_PIN_MODE_DIO , PULL_UP   , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_BOTH_EDGES , STD_ON , STD_ON ) \
+    CHANNEL( LED2 , PORT_PIN_LEVEL_LOW , PORT_PIN_OUT , PORT_PIN_MODE_DIO , OFF       , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_NONE       , STD_ON , STD_ON ) \
+    CHANNEL( LED3 , PORT_PIN_LEVEL_LOW , PORT_PIN_OUT , PORT_PIN_MODE_DIO , OFF       , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_NONE       , STD_ON , STD_ON )
+
+#define PortConf_PARKED_CONFIG_SET(CHANNEL) \
+    CHANNEL( LED1 , PORT_PIN_LEVEL_LOW , PORT_PIN_IN  , PORT_PIN_MODE_DIO , PULL_DOWN , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_NONE       , STD_ON , STD_ON ) \
+    CHANNEL( SW1  , PORT_PIN_LEVEL_LOW , PORT_PIN_IN  , PORT_PIN_MODE_DIO , PULL_UP   , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_BOTH_EDGES , STD_ON , STD_ON ) \
+    CHANNEL( LED2 , PORT_PIN_LEVEL_LOW , PORT_PIN_IN  , PORT_PIN_MODE_DIO , PULL_DOWN , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_NONE       , STD_ON , STD_ON ) \
+    CHANNEL( LED3 , PORT_PIN_LEVEL_LOW , PORT_PIN_IN  , PORT_PIN_MODE_DIO , PULL_DOWN , PORT_PIN_DRIVE_2MA , STD_OFF , PORT_PIN_INTERRUPT_NONE       , STD_ON , STD_ON )
+
+/* CRC-32 of the Channels of every configuration set , stored in its image header and checked by Port_Init.
+ * Generated by "python tools/config_image.py tools/pin_map.json --print-crc" , regenerate them whenever
+ * a set changes or Port_Init rejects the set (PORT_E_PARAM_CONFIG).
+ * The CCS pre-build step (config_image.py --check) fails the build when these CRCs or the rows of the
+ * configuration sets above differ from tools/pin_map.json. */
+#define PortConf_ACTIVE_CONFIG_SET_CRC        (0xCF25127EU)
+#define PortConf_PARKED_CONFIG_SET_CRC        (0xBF5B6739U)
+
+/* Expand OP for every configuration set */
+#define PortConf_CONFIG_SETS(OP) \
+    OP( ACTIVE ) \
+    OP( PARKED )
 
 #endif /* PORT_CFG_H_ */
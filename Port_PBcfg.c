@@ -38,24 +38,46 @@
 
 /* Now the configuration array of Structures */
 /*
- * Data Type : Port_ConfigType , Which is an array of structures of type Port_ConfigChannel
- * Holds the following :
- *
- *  uint8                   Port_Num;
-    Port_PinType            Ch_Num;
-    uint8                   Ch_Initial_value;
-    boolean                 Ch_Direction_Changeable;
-    boolean                 Ch_Mode_Changeable;
-    Port_PinDirectionType   Ch_Direction;
-    Port_PinModeType        Ch_Mode;
-    Port_InternalResistor   Resistor;
+ * Data Type : Port_ConfigType , Which is an array of uint32 words of type Port_ConfigChannel ,
+ * one word per pin packed by PORT_CHANNEL_ENCODE (see Port.h for the layout).
  *
  */
 
-extern const Port_ConfigType Port_Configuration = {
+/* Row of a configuration set , placed at the index of its channel */
+#define PORT_CHANNEL_INIT(NAME,INIT,DIR,MODE,RES,DRIVE,SLEW,INT,DIR_CHG,MODE_CHG) \
+    [PortConf_##NAME##_CHANNEL_ID_INDEX] = PORT_CHANNEL_ENCODE(PortConf_##NAME##_PORT_NUM , PortConf_##NAME##_CHANNEL_NUM , \
+                                                               INIT , DIR , MODE , RES , DRIVE , SLEW , INT , DIR_CHG , MODE_CHG),
 
-        PORT_F , PORT_PIN_1 , PORT_PIN_LEVEL_LOW , PORT_PIN_OUT , PORT_PIN_MODE_DIO , OFF     , STD_ON , STD_ON,
-        PORT_F , PORT_PIN_4 , PORT_PIN_LEVEL_LOW , PORT_PIN_IN  , PORT_PIN_MODE_DIO , PULL_UP , STD_ON , STD_ON,
-};
+/* Compile time checks of every configuration set:
+ *  1. every pin exists on its port , is not a JTAG pin and has a valid mode , direction , level , resistor ,
+ *     drive strength , slew rate control (8mA drive only) and interrupt (digital pins only).
+ *  2. no pin is configured twice.
+ *  3. every channel index is used once and all the PORT_CONFIGURED_CHANNELS channels are configured.
+ */
+#define PORT_CHECK_CONFIG_SET(SET) \
+    STATIC_ASSERT((1 PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_IS_VALID)) , Port_##SET##_Set_Has_Invalid_Pin) ; \
+    STATIC_ASSERT(((uint64)0 PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_KEY_SUM)) \
+               == ((uint64)0 PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_KEY_OR)) , Port_##SET##_Set_Has_Duplicate_Pin) ; \
+    STATIC_ASSERT(((uint64)0 PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_INDEX_SUM)) \
+               == ((uint64)0 PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_INDEX_OR)) , Port_##SET##_Set_Has_Duplicate_Index) ; \
+    STATIC_ASSERT((0U PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_COUNT)) == PORT_CONFIGURED_CHANNELS , Port_##SET##_Set_Channels_Count) ;
+
+PortConf_CONFIG_SETS(PORT_CHECK_CONFIG_SET)
 
+/* The image of a set is its header followed by the pin words without any padding */
+STATIC_ASSERT(sizeof(Config_ImageHeaderType) == 24U , Config_Image_Header_Has_Padding) ;
+STATIC_ASSERT(sizeof(Port_ConfigType) == (sizeof(Config_ImageHeaderType) + PORT_CONFIG_IMAGE_LENGTH) , Port_Config_Image_Has_Padding) ;
+
+/* Image of one configuration set , placed at the index of the set */
+#define PORT_CONFIG_SET_INIT(SET) \
+    [PortConf_##SET##_CONFIG_SET_ID] = { \
+        CONFIG_IMAGE_HEADER(PORT , PortConf_##SET##_CONFIG_SET_ID , PORT_CONFIG_IMAGE_LENGTH , PortConf_##SET##_CONFIG_SET_CRC) , \
+        { PortConf_##SET##_CONFIG_SET(PORT_CHANNEL_INIT) } \
+    },
+
+/* One configuration set per row list in Port_Cfg.h , in the .port_config flash section */
+#pragma DATA_SECTION(Port_ConfigurationSets, ".port_config")
+extern const Port_ConfigType Port_ConfigurationSets[PORT_CONFIGURATION_SETS] = {
+    PortConf_CONFIG_SETS(PORT_CONFIG_SET_INIT)
+};
 
@@ -1,8 +1,12 @@
 #include "Os.h"
+#include "Mcu.h"
 
 
 int main(void)
 {
+    /* Run the core at the configured clock before any timer is started */
+    Mcu_Init();
+
     /* Start the Os */
     Os_start();
 
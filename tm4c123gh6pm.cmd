@@ -10,7 +10,10 @@
 
 MEMORY
 {
-    FLASH (RX) : origin = 0x00000000, length = 0x00040000
+    FLASH (RX) : origin = 0x00000000, length = 0x0003F000
+    /* Last 4 KB (4 erase blocks) hold the post-build configuration images,
+     * they can be reflashed without the application (tools/config_image.py) */
+    CONFIG (R) : origin = 0x0003F000, length = 0x00001000
     SRAM (RWX) : origin = 0x20000000, length = 0x00008000
 }
 
@@ -35,6 +38,14 @@ SECTIONS
     .pinit  :   > FLASH
     .init_array : > FLASH
 
+    /* Post-build configuration images , in the order and at the addresses flashed by tools/config_image.py ,
+     * a Port image above 2 KB pushes .dio_config out of CONFIG and fails the link */
+    GROUP > CONFIG
+    {
+        .port_config                    /* Port_ConfigurationSets at 0x0003F000 , one slot per configuration set */
+        .dio_config  : align = 0x800    /* Dio_Configuration at 0x0003F800 */
+    }
+
     .vtable :   > 0x20000000
     .data   :   > SRAM
     .bss    :   > SRAM
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""
+Build the post-build configuration images of the Port and Dio drivers.
+
+The description file (see pin_map.json) lists the Port configuration sets in slot order
+and the Dio channels and channel groups in index order. The images have the layout of
+Port_ConfigType / Dio_ConfigType (Config_Image.h , Port.h , Dio.h):
+
+    header (24 bytes) : magic "CFG1" , module id , vendor id , AR version , SW version ,
+                        config id , reserved , payload length , CRC-32 of the payload
+    payload           : Port - one little-endian uint32 word per pin (PORT_CHANNEL_ENCODE)
+                        Dio  - one PIN_ID byte per channel , then mask/offset/port per group
+
+usage:
+    config_image.py pin_map.json --print-crc        CRC defines for Port_Cfg.h and Dio_Cfg.h
+    config_image.py pin_map.json --check            check the rows and CRCs of Port_Cfg.h and Dio_Cfg.h
+                                                    against the description (CCS pre-build step)
+    config_image.py pin_map.json -o out/            port_config.bin (flash at 0x0003F000)
+                                                    dio_config.bin  (flash at 0x0003F800)
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+CONFIG_IMAGE_MAGIC = 0x31474643
+HEADER_FORMAT = "<IHH8BII"
+
+PORTS = "ABCDEF"
+PINS_PER_PORT = [8, 8, 8, 8, 6, 5]
+
+MODES = dict({"ADC": 0, "DIO": 16}, **{"ALT_%d" % n: n for n in list(range(1, 10)) + [14, 15]})
+DIRECTIONS = {"IN": 0, "OUT": 1}
+LEVELS = {"LOW": 0, "HIGH": 1}
+RESISTORS = {"OFF": 0, "PULL_UP": 1, "PULL_DOWN": 2}
+DRIVES = {"2MA": 0, "4MA": 1, "8MA": 2}
+INTERRUPTS = {"NONE": 0, "FALLING_EDGE": 1, "RISING_EDGE": 2, "BOTH_EDGES": 3, "LOW_LEVEL": 4, "HIGH_LEVEL": 5}
+
+
+class ConfigError(Exception):
+    pass
+
+
+def read_module_ids(header_path, module):
+    """Module id , vendor id and versions from the #defines of Port.h / Dio.h."""
+    names = ["MODULE_ID", "VENDOR_ID",
+             "AR_RELEASE_MAJOR_VERSION", "AR_RELEASE_MINOR_VERSION", "AR_RELEASE_PATCH_VERSION",
+             "SW_MAJOR_VERSION", "SW_MINOR_VERSION", "SW_PATCH_VERSION"]
+    with open(header_path) as f:
+        text = f.read()
+    values = {}
+    for name in names:
+        match = re.search(r"#define\s+%s_%s\s+\((\d+)U\)" % (module, name), text)
+        if not match:
+            raise ConfigError("%s_%s not found in %s" % (module, name, header_path))
+        values[name] = int(match.group(1))
+    return values
+
+
+def header(ids, config_id, payload):
+    return struct.pack(HEADER_FORMAT, CONFIG_IMAGE_MAGIC, ids["MODULE_ID"], ids["VENDOR_ID"],
+                       ids["AR_RELEASE_MAJOR_VERSION"], ids["AR_RELEASE_MINOR_VERSION"],
+                       ids["AR_RELEASE_PATCH_VERSION"], ids["SW_MAJOR_VERSION"], ids["SW_MINOR_VERSION"],
+                       ids["SW_PATCH_VERSION"], config_id, 0, len(payload), zlib.crc32(payload) & 0xFFFFFFFF)
+
+
+def pin_id(entry, where):
+    port = PORTS.find(str(entry["port"]).upper())
+    pin = entry["pin"]
+    if port < 0 or not 0 <= pin < PINS_PER_PORT[port]:
+        raise ConfigError("%s: P%s%s does not exist" % (where, entry["port"], pin))
+    return port, pin
+
+
+def lookup(table, entry, key, where):
+    value = str(entry[key]).upper()
+    if value not in table:
+        raise ConfigError("%s: invalid %s '%s'" % (where, key, entry[key]))
+    return table[value]
+
+
+def encode_channel(channel, where):
+    """Same checks as PORT_CHANNEL_IS_VALID , same packing as PORT_CHANNEL_ENCODE."""
+    port, pin = pin_id(channel, where)
+    if port == 2 and pin <= 3:
+        raise ConfigError("%s: JTAG pin PC%d shall not be configured" % (where, pin))
+    mode = lookup(MODES, channel, "mode", where)
+    drive = lookup(DRIVES, channel, "drive", where)
+    interrupt = lookup(INTERRUPTS, channel, "interrupt", where)
+    slew = 1 if channel.get("slew", False) else 0
+    if slew and drive != DRIVES["8MA"]:
+        raise ConfigError("%s: slew rate control needs the 8mA drive" % where)
+    if interrupt and mode == MODES["ADC"]:
+        raise ConfigError("%s: interrupt on an analog pin" % where)
+    return ((port << 3) | pin
+            | mode << 6
+            | lookup(DIRECTIONS, channel, "direction", where) << 11
+            | lookup(LEVELS, channel, "level", where) << 12
+            | lookup(RESISTORS, channel, "resistor", where) << 13
+            | drive << 15
+            | slew << 17
+            | interrupt << 18
+            | (1 if channel.get("direction_changeable", False) else 0) << 21
+            | (1 if channel.get("mode_changeable", False) else 0) << 22)
+
+
+def port_images(description, ids):
+    """One image per set , in slot order. Returns [(name , image , crc)]."""
+    sets = description["port"]["sets"]
+    count = None
+    images = []
+    for config_id, config_set in enumerate(sets):
+        words = []
+        used = set()
+        for channel in config_set["channels"]:
+            where = "port set %s channel %s" % (config_set["name"], channel.get("name", len(words)))
+            word = encode_channel(channel, where)
+            if word & 0x3F in used:
+                raise ConfigError("%s: pin configured twice" % where)
+            used.add(word & 0x3F)
+            words.append(word)
+        if count is not None and len(words) != count:
+            raise ConfigError("port set %s: all the sets shall configure the same channels" % config_set["name"])
+        count = len(words)
+        payload = struct.pack("<%dI" % len(words), *words)
+        images.append((config_set["name"], header(ids, config_id, payload) + payload, zlib.crc32(payload) & 0xFFFFFFFF))
+    return images
+
+
+def dio_image(description, ids):
+    dio = description["dio"]
+    payload = bytearray()
+    for channel in dio["channels"]:
+        port, pin = pin_id(channel, "dio channel %s" % channel.get("name", len(payload)))
+        payload.append((port << 3) | pin)
+    for group in dio["groups"]:
+        where = "dio group %s" % group.get("name", "")
+        port = PORTS.find(str(group["port"]).upper())
+        mask, offset = group["mask"], group["offset"]
+        run = mask >> offset
+        if port < 0 or not run & 1 or (run + 1) & run:
+            raise ConfigError("%s: the mask shall be one run of pins starting at the offset" % where)
+        payload += bytes([mask, offset, port])
+    payload = bytes(payload)
+    image = header(ids, 0, payload) + payload
+    image += bytes(-len(image) % 4)    # tail padding of Dio_ConfigType
+    return image, zlib.crc32(payload) & 0xFFFFFFFF
+
+
+def header_defines(text):
+    """Integer value of every #define NAME (type)value / (valueU) of a header."""
+    defines = {}
+    for match in re.finditer(r"^#define\s+(\w+)\s+(?:\(\w+\))?\(?(0x[0-9A-Fa-f]+|\d+)U?\)?", text, re.M):
+        defines[match.group(1)] = int(match.group(2), 0)
+    return defines
+
+
+def macro_rows(text, macro):
+    """Argument lists of the rows of the X-macro list MACRO , e.g. PortConf_ACTIVE_CONFIG_SET(CHANNEL)."""
+    match = re.search(r"^#define\s+%s\(\w+\)\s*\\\n((?:.*\\\n)*.*)$" % macro, text, re.M)
+    if not match:
+        raise ConfigError("%s not found" % macro)
+    return [[arg.strip() for arg in args.split(",")] for args in re.findall(r"\w+\(([^)]*)\)", match.group(1))]
+
+
+def strip_prefix(value, prefix):
+    return value[len(prefix):] if value.startswith(prefix) else value
+
+
+def header_channel(args, defines):
+    """Description entry of a CHANNEL( ... ) row of Port_Cfg.h."""
+    name = args[0]
+    return {
+        "name": name,
+        "port": PORTS[defines["PortConf_%s_PORT_NUM" % name]],
+        "pin": defines["PortConf_%s_CHANNEL_NUM" % name],
+        "level": strip_prefix(args[1], "PORT_PIN_LEVEL_"),
+        "direction": strip_prefix(args[2], "PORT_PIN_"),
+        "mode": strip_prefix(args[3], "PORT_PIN_MODE_"),
+        "resistor": args[4],
+        "drive": strip_prefix(args[5], "PORT_PIN_DRIVE_"),
+        "slew": args[6] == "STD_ON",
+        "interrupt": strip_prefix(args[7], "PORT_PIN_INTERRUPT_"),
+        "direction_changeable": args[8] == "STD_ON",
+        "mode_changeable": args[9] == "STD_ON",
+    }
+
+
+def check_headers(description, ports, dio_crc, include):
+    """Mismatches between the description and the hand written rows and CRCs of Port_Cfg.h and Dio_Cfg.h."""
+    errors = []
+    with open(os.path.join(include, "Port_Cfg.h")) as f:
+        port_text = f.read()
+    with open(os.path.join(include, "Dio_Cfg.h")) as f:
+        dio_text = f.read()
+    port_defines = header_defines(port_text)
+    dio_defines = header_defines(dio_text)
+
+    set_names = [args[0] for args in macro_rows(port_text, "PortConf_CONFIG_SETS")]
+    if set_names != [config_set["name"] for config_set in description["port"]["sets"]]:
+        errors.append("Port_Cfg.h: PortConf_CONFIG_SETS %s differs from the description sets" % set_names)
+    for config_set, (name, _, crc) in zip(description["port"]["sets"], ports):
+        rows = macro_rows(port_text, "PortConf_%s_CONFIG_SET" % name)
+        where = "Port_Cfg.h set %s" % name
+        for index, (args, channel) in enumerate(zip(rows, config_set["channels"])):
+            if args[0] != channel["name"] or \
+               encode_channel(header_channel(args, port_defines), where) != encode_channel(channel, where):
+                errors.append("%s: row %d (%s) differs from the description" % (where, index, args[0]))
+        if len(rows) != len(config_set["channels"]):
+            errors.append("%s: %d rows , the description has %d channels" % (where, len(rows), len(config_set["channels"])))
+        if port_defines.get("PortConf_%s_CONFIG_SET_CRC" % name) != crc:
+            errors.append("%s: PortConf_%s_CONFIG_SET_CRC is not 0x%08X" % (where, name, crc))
+
+    channels = [args[0] for args in macro_rows(dio_text, "DioConf_CHANNELS")]
+    if channels != [channel["name"] for channel in description["dio"]["channels"]]:
+        errors.append("Dio_Cfg.h: DioConf_CHANNELS %s differs from the description channels" % channels)
+    for channel in description["dio"]["channels"]:
+        if (dio_defines.get("DioConf_%s_PORT_NUM" % channel["name"]), dio_defines.get("DioConf_%s_CHANNEL_NUM" % channel["name"])) \
+           != pin_id(channel, "dio channel %s" % channel["name"]):
+            errors.append("Dio_Cfg.h: channel %s differs from the description" % channel["name"])
+    groups = [args[0] for args in macro_rows(dio_text, "DioConf_CHANNEL_GROUPS")]
+    if groups != [group["name"] for group in description["dio"]["groups"]]:
+        errors.append("Dio_Cfg.h: DioConf_CHANNEL_GROUPS %s differs from the description groups" % groups)
+    for group in description["dio"]["groups"]:
+        prefix = "DioConf_%s_GROUP_" % group["name"]
+        if (dio_defines.get(prefix + "PORT_NUM"), dio_defines.get(prefix + "MASK"), dio_defines.get(prefix + "OFFSET")) \
+           != (PORTS.find(str(group["port"]).upper()), group["mask"], group["offset"]):
+            errors.append("Dio_Cfg.h: group %s differs from the description" % group["name"])
+    if dio_defines.get("DioConf_CONFIGURATION_CRC") != dio_crc:
+        errors.append("Dio_Cfg.h: DioConf_CONFIGURATION_CRC is not 0x%08X" % dio_crc)
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build the Port and Dio post-build configuration images.")
+    parser.add_argument("description", help="JSON description of the pin map")
+    parser.add_argument("-o", "--output", help="directory of port_config.bin and dio_config.bin")
+    parser.add_argument("--print-crc", action="store_true", help="print the CRC defines of Port_Cfg.h and Dio_Cfg.h")
+    parser.add_argument("--check", action="store_true",
+                        help="fail when the rows or the CRC defines of Port_Cfg.h and Dio_Cfg.h differ from the description")
+    parser.add_argument("--include", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."),
+                        help="directory of Port.h and Dio.h (default: the repository root)")
+    args = parser.parse_args()
+
+    try:
+        with open(args.description) as f:
+            description = json.load(f)
+        ports = port_images(description, read_module_ids(os.path.join(args.include, "Port.h"), "PORT"))
+        dio, dio_crc = dio_image(description, read_module_ids(os.path.join(args.include, "Dio.h"), "DIO"))
+        errors = check_headers(description, ports, dio_crc, args.include) if args.check else []
+    except (ConfigError, KeyError, ValueError, IndexError) as error:
+        sys.exit("config_image: %s" % error)
+
+    if errors:
+        sys.exit("config_image: the configuration headers differ from %s , update them from it "
+                 "(--print-crc gives the CRC defines):\n  %s" % (args.description, "\n  ".join(errors)))
+
+    if args.print_crc:
+        for name, _, crc in ports:
+            print("#define PortConf_%s_CONFIG_SET_CRC        (0x%08XU)" % (name, crc))
+        print("#define DioConf_CONFIGURATION_CRC            (0x%08XU)" % dio_crc)
+
+    if args.output:
+        os.makedirs(args.output, exist_ok=True)
+        with open(os.path.join(args.output, "port_config.bin"), "wb") as f:
+            f.write(b"".join(image for _, image, _ in ports))
+        with open(os.path.join(args.output, "dio_config.bin"), "wb") as f:
+            f.write(dio)
+
+
+if __name__ == "__main__":
+    main()